@@ -43,6 +43,7 @@ using namespace APEX2;
 #ifdef ACF_KERNEL_METADATA
 
 #include "arithmetic_acf.h"
+#include "inplace_acf.h"
 /*!*********************************************************************************
 *  \brief ACF metadata for the abs kernel
 *  \see UG-10267-03 ACF User Guide, Section 3.2.2
@@ -1660,15 +1661,31 @@ KERNEL_INFO kernelInfoConcat(XOR_32u_K)
           __ek_size(1, 1))
 );
 
+/*!*********************************************************************************
+*  \brief Kernels whose output may overwrite one of their inputs
+*
+*  Both ports of each pair have the same geometry and element size, so a graph
+*  can bind them to the same buffer when the input is dead afterwards.
+***********************************************************************************/
+const ACF_INPLACE_PORT_PAIR gArithmeticInplacePorts[] =
+{
+   { ABS_08u_KN,   0, 1 },
+   { ACCUM_16s_KN, 1, 2 },
+   { NOT_08u_KN,   0, 1 },
+};
+const int gArithmeticInplacePortsCount = sizeof(gArithmeticInplacePorts) / sizeof(gArithmeticInplacePorts[0]);
+
 #endif //#ifdef ACF_KERNEL_METADATA
 
 #ifdef ACF_KERNEL_IMPLEMENTATION
 
 #include "arithmetic_apu.h"
+#include "arithmetic_packed_apu.h"
 #include <stdint.h>
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the abs kernel (unsigned 8 bit)
+*         May run in place: the graph can bind INPUT_0 and OUTPUT_0 to the same buffer.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void abs_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
@@ -1715,6 +1732,7 @@ void absdiff_16s(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the accumulate kernel (signed 16 bit)
+*         May run in place: the graph can bind INPUT_1 and OUTPUT_0 to the same buffer.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void accumulate_16s(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
@@ -1767,6 +1785,8 @@ void accumulate_weighted_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the add kernel (unsigned 8 bit)
+*  Runs two pixels per lane with the wrap policy when chunkWidth, all spans
+*  and all buffer addresses are even.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void add_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lPolicy, kernel_io_desc lOut0)
@@ -1780,6 +1800,17 @@ void add_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lPolicy, k
    {
       lSaturate = false; // use eCONVERT_POLICY_WRAP
    }
+   if(!lSaturate &&
+      apu_packed_08x2_ok(lIn0.chunkWidth,
+                         lIn0.chunkSpan | lIn1.chunkSpan | lOut0.chunkSpan,
+                         (uintptr_t)lpvIn0 | (uintptr_t)lpvIn1 | (uintptr_t)lpvOut0))
+   {
+      apu_add_08x2( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan,
+                    lpvIn1, lIn1.chunkSpan,
+                    lIn0.chunkWidth, lIn0.chunkHeight );
+      return;
+   }
    apu_add( lpvOut0, lOut0.chunkSpan, 
             lpvIn0, lIn0.chunkSpan, 
             lpvIn1, lIn1.chunkSpan, 
@@ -1855,6 +1886,8 @@ void add_16s(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lPolicy, k
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the and kernel (unsigned 8 bit)
+*  Runs two pixels per lane when chunkWidth, all spans and all buffer
+*  addresses are even.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void and_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
@@ -1863,6 +1896,16 @@ void and_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
    vec08u* lpvIn1  = (vec08u*)lIn1.pMem;
    vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
    
+   if(apu_packed_08x2_ok(lIn0.chunkWidth,
+                         lIn0.chunkSpan | lIn1.chunkSpan | lOut0.chunkSpan,
+                         (uintptr_t)lpvIn0 | (uintptr_t)lpvIn1 | (uintptr_t)lpvOut0))
+   {
+      apu_and_08x2( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan,
+                    lpvIn1, lIn1.chunkSpan,
+                    lIn0.chunkWidth, lIn0.chunkHeight );
+      return;
+   }
    apu_and( lpvOut0, lOut0.chunkSpan, 
             lpvIn0, lIn0.chunkSpan, 
             lpvIn1, lIn1.chunkSpan, 
@@ -2146,6 +2189,7 @@ void mul_16s(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lScale, ke
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the bitwise not kernel (unsigned 8 bit)
+*         May run in place: the graph can bind INPUT_0 and OUTPUT_0 to the same buffer.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void not_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
@@ -2160,6 +2204,8 @@ void not_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the or kernel (unsigned 8 bit)
+*  Runs two pixels per lane when chunkWidth, all spans and all buffer
+*  addresses are even.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void or_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
@@ -2168,6 +2214,16 @@ void or_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
    vec08u* lpvIn1  = (vec08u*)lIn1.pMem;
    vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
    
+   if(apu_packed_08x2_ok(lIn0.chunkWidth,
+                         lIn0.chunkSpan | lIn1.chunkSpan | lOut0.chunkSpan,
+                         (uintptr_t)lpvIn0 | (uintptr_t)lpvIn1 | (uintptr_t)lpvOut0))
+   {
+      apu_or_08x2( lpvOut0, lOut0.chunkSpan,
+                   lpvIn0, lIn0.chunkSpan,
+                   lpvIn1, lIn1.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight );
+      return;
+   }
    apu_or( lpvOut0, lOut0.chunkSpan, 
             lpvIn0, lIn0.chunkSpan, 
             lpvIn1, lIn1.chunkSpan, 
@@ -2209,6 +2265,8 @@ void or_32u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the sub kernel (unsigned 8 bit)
+*  Runs two pixels per lane with the wrap policy when chunkWidth, all spans
+*  and all buffer addresses are even.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void sub_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lPolicy, kernel_io_desc lOut0)
@@ -2222,6 +2280,17 @@ void sub_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lPolicy, k
    {
       lSaturate = false; // use eCONVERT_POLICY_WRAP
    }
+   if(!lSaturate &&
+      apu_packed_08x2_ok(lIn0.chunkWidth,
+                         lIn0.chunkSpan | lIn1.chunkSpan | lOut0.chunkSpan,
+                         (uintptr_t)lpvIn0 | (uintptr_t)lpvIn1 | (uintptr_t)lpvOut0))
+   {
+      apu_sub_08x2( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan,
+                    lpvIn1, lIn1.chunkSpan,
+                    lIn0.chunkWidth, lIn0.chunkHeight );
+      return;
+   }
    apu_sub( lpvOut0, lOut0.chunkSpan, 
             lpvIn0, lIn0.chunkSpan, 
             lpvIn1, lIn1.chunkSpan, 
@@ -2466,6 +2535,8 @@ void threshold_range_32u(kernel_io_desc lIn0, kernel_io_desc lThreshold, kernel_
 
 /*!*********************************************************************************
 *  \brief ACF wrapper function for the xor kernel (unsigned 8 bit)
+*  Runs two pixels per lane when chunkWidth, all spans and all buffer
+*  addresses are even.
 *  \see UG-10267-03 ACF User Guide, Section 3.2.3
 ***********************************************************************************/                                 
 void xor_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
@@ -2474,6 +2545,16 @@ void xor_08u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
    vec08u* lpvIn1  = (vec08u*)lIn1.pMem;
    vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
    
+   if(apu_packed_08x2_ok(lIn0.chunkWidth,
+                         lIn0.chunkSpan | lIn1.chunkSpan | lOut0.chunkSpan,
+                         (uintptr_t)lpvIn0 | (uintptr_t)lpvIn1 | (uintptr_t)lpvOut0))
+   {
+      apu_xor_08x2( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan,
+                    lpvIn1, lIn1.chunkSpan,
+                    lIn0.chunkWidth, lIn0.chunkHeight );
+      return;
+   }
    apu_xor( lpvOut0, lOut0.chunkSpan, 
             lpvIn0, lIn0.chunkSpan, 
             lpvIn1, lIn1.chunkSpan, 
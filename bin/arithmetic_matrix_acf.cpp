@@ -0,0 +1,241 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file arithmetic_matrix_acf.cpp
+* \addtogroup apexcv-arithmetic
+* \addtogroup arithmetic
+* \ingroup arithmetic
+* @{
+* \brief arithmetic operations for every combination of element types
+*/
+
+/*!*********************************************************************************
+*  @file arithmetic_matrix_acf.cpp
+*  @brief ACF metadata and wrapper functions generated from the type lists in
+*         arithmetic_matrix_acf.h
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#include "arithmetic_matrix_acf.h"
+
+#ifdef ACF_KERNEL_METADATA
+
+/*!*********************************************************************************
+*  \brief ACF metadata for a two input kernel with a saturate/wrap policy port
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+#define ARITHMETIC_MATRIX_POLICY_KERNEL_INFO(op, TA, TB, TO)                   \
+KERNEL_INFO kernelInfoConcat(op##_##TA##_##TB##_##TO)                            \
+(                                                                                \
+   #op "_" #TA "_" #TB "_" #TO,                                                  \
+   4,                                                                            \
+   __port(__index(0),                                                            \
+          __identifier(INPUT_0),                                                 \
+          __attributes(ACF_ATTR_VEC_IN),                                         \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##TA),                                                 \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(1),                                                            \
+          __identifier(INPUT_1),                                                 \
+          __attributes(ACF_ATTR_VEC_IN),                                         \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##TB),                                                 \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(2),                                                            \
+          __identifier(INPUT_2),                                                 \
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),                            \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d08u),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(3),                                                            \
+          __identifier(OUTPUT_0),                                                \
+          __attributes(ACF_ATTR_VEC_OUT),                                        \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##TO),                                                 \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1))                                                       \
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for a two input kernel of one type with a saturate/wrap policy port
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+#define ARITHMETIC_MATRIX_POLICY_SAME_TYPE_KERNEL_INFO(op, T)                  \
+KERNEL_INFO kernelInfoConcat(op##_##T)                                           \
+(                                                                                \
+   #op "_" #T,                                                                   \
+   4,                                                                            \
+   __port(__index(0),                                                            \
+          __identifier(INPUT_0),                                                 \
+          __attributes(ACF_ATTR_VEC_IN),                                         \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##T),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(1),                                                            \
+          __identifier(INPUT_1),                                                 \
+          __attributes(ACF_ATTR_VEC_IN),                                         \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##T),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(2),                                                            \
+          __identifier(INPUT_2),                                                 \
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),                            \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d08u),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(3),                                                            \
+          __identifier(OUTPUT_0),                                                \
+          __attributes(ACF_ATTR_VEC_OUT),                                        \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##T),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1))                                                       \
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for a two input kernel with the same type in and out
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+#define ARITHMETIC_MATRIX_SAME_TYPE_KERNEL_INFO(op, T)                         \
+KERNEL_INFO kernelInfoConcat(op##_##T)                                           \
+(                                                                                \
+   #op "_" #T,                                                                   \
+   3,                                                                            \
+   __port(__index(0),                                                            \
+          __identifier(INPUT_0),                                                 \
+          __attributes(ACF_ATTR_VEC_IN),                                         \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##T),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(1),                                                            \
+          __identifier(INPUT_1),                                                 \
+          __attributes(ACF_ATTR_VEC_IN),                                         \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##T),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1)),                                                      \
+   __port(__index(2),                                                            \
+          __identifier(OUTPUT_0),                                                \
+          __attributes(ACF_ATTR_VEC_OUT),                                        \
+          __spatial_dep(0,0,0,0),                                                \
+          __e0_data_type(d##T),                                                  \
+          __e0_size(1, 1),                                                       \
+          __ek_size(1, 1))                                                       \
+);
+
+ARITHMETIC_MATRIX_ADD_LIST(ARITHMETIC_MATRIX_POLICY_KERNEL_INFO)
+ARITHMETIC_MATRIX_SUB_LIST(ARITHMETIC_MATRIX_POLICY_KERNEL_INFO)
+ARITHMETIC_MATRIX_POLICY_SAME_TYPE_LIST(ARITHMETIC_MATRIX_POLICY_SAME_TYPE_KERNEL_INFO)
+ARITHMETIC_MATRIX_SAME_TYPE_LIST(ARITHMETIC_MATRIX_SAME_TYPE_KERNEL_INFO)
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "arithmetic_matrix_apu.h"
+#include <stdint.h>
+
+/* Operation functor of the same type kernels */
+#define ARITHMETIC_MATRIX_OP_and        MatrixAnd
+#define ARITHMETIC_MATRIX_OP_or         MatrixOr
+#define ARITHMETIC_MATRIX_OP_xor        MatrixXor
+#define ARITHMETIC_MATRIX_OP_min        MatrixMin
+#define ARITHMETIC_MATRIX_OP_max        MatrixMax
+#define ARITHMETIC_MATRIX_OP_absdiff    MatrixAbsdiff
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for a two input kernel with a saturate/wrap policy port
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+#define ARITHMETIC_MATRIX_POLICY_WRAPPER(op, TA, TB, TO)                                          \
+void op##_##TA##_##TB##_##TO(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lPolicy, kernel_io_desc lOut0) \
+{                                                                                                   \
+   vec##TA* lpvIn0  = (vec##TA*)lIn0.pMem;                                                          \
+   vec##TB* lpvIn1  = (vec##TB*)lIn1.pMem;                                                          \
+   uint8_t* lpPolicy = (uint8_t*)lPolicy.pMem;                                                      \
+   vec##TO* lpvOut0 = (vec##TO*)lOut0.pMem;                                                         \
+   bool lSaturate = (lpPolicy[0] != 0); /* 0: eCONVERT_POLICY_WRAP */                               \
+                                                                                                    \
+   apu_matrix_##op( lpvOut0, lOut0.chunkSpan / sizeof(int##TO),                                     \
+                    lpvIn0, lIn0.chunkSpan / sizeof(int##TA),                                       \
+                    lpvIn1, lIn1.chunkSpan / sizeof(int##TB),                                       \
+                    lIn0.chunkWidth, lIn0.chunkHeight,                                              \
+                    lSaturate );                                                                    \
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for a two input kernel of one type with a saturate/wrap policy port
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+#define ARITHMETIC_MATRIX_POLICY_SAME_TYPE_WRAPPER(op, T)                                         \
+void op##_##T(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lPolicy, kernel_io_desc lOut0) \
+{                                                                                                   \
+   vec##T*  lpvIn0  = (vec##T*)lIn0.pMem;                                                           \
+   vec##T*  lpvIn1  = (vec##T*)lIn1.pMem;                                                           \
+   uint8_t* lpPolicy = (uint8_t*)lPolicy.pMem;                                                      \
+   vec##T*  lpvOut0 = (vec##T*)lOut0.pMem;                                                          \
+   bool lSaturate = (lpPolicy[0] != 0); /* 0: eCONVERT_POLICY_WRAP */                               \
+                                                                                                    \
+   apu_matrix_##op( lpvOut0, lOut0.chunkSpan / sizeof(int##T),                                      \
+                    lpvIn0, lIn0.chunkSpan / sizeof(int##T),                                        \
+                    lpvIn1, lIn1.chunkSpan / sizeof(int##T),                                        \
+                    lIn0.chunkWidth, lIn0.chunkHeight,                                              \
+                    lSaturate );                                                                    \
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for a two input kernel with the same type in and out
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+#define ARITHMETIC_MATRIX_SAME_TYPE_WRAPPER(op, T)                                                \
+void op##_##T(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)                       \
+{                                                                                                   \
+   vec##T* lpvIn0  = (vec##T*)lIn0.pMem;                                                            \
+   vec##T* lpvIn1  = (vec##T*)lIn1.pMem;                                                            \
+   vec##T* lpvOut0 = (vec##T*)lOut0.pMem;                                                           \
+                                                                                                    \
+   apu_matrix_binary<ARITHMETIC_MATRIX_OP_##op>( lpvOut0, lOut0.chunkSpan / sizeof(int##T),         \
+                                                 lpvIn0, lIn0.chunkSpan / sizeof(int##T),           \
+                                                 lpvIn1, lIn1.chunkSpan / sizeof(int##T),           \
+                                                 lIn0.chunkWidth, lIn0.chunkHeight );               \
+}
+
+ARITHMETIC_MATRIX_ADD_LIST(ARITHMETIC_MATRIX_POLICY_WRAPPER)
+ARITHMETIC_MATRIX_SUB_LIST(ARITHMETIC_MATRIX_POLICY_WRAPPER)
+ARITHMETIC_MATRIX_POLICY_SAME_TYPE_LIST(ARITHMETIC_MATRIX_POLICY_SAME_TYPE_WRAPPER)
+ARITHMETIC_MATRIX_SAME_TYPE_LIST(ARITHMETIC_MATRIX_SAME_TYPE_WRAPPER)
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
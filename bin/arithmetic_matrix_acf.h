@@ -0,0 +1,149 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file arithmetic_matrix_acf.h
+*  @brief Type combinations of the generated arithmetic kernels
+*
+*  The kernels are named <op>_<in0>_<in1>_<out> for mixed input types and
+*  <op>_<type> when both inputs and the output have the same type, e.g.
+*  add_08u_08s_16s, add_16u or and_08s, as in arithmetic_acf.cpp. The output
+*  of a mixed pair is the smallest type holding the ranges of both inputs
+*  (mixed signedness widens to signed; 32s when a 32u meets a signed type).
+*  Results that do not fit the output, e.g. of add_08s or of an unsigned
+*  sub, wrap or saturate as selected by the policy port. The hand written
+*  kernels of arithmetic_acf.cpp are not repeated here. To add a combination,
+*  add one line to the matching list.
+*
+*  mul and threshold are not part of the matrix. mul takes a scale port and
+*  its product needs a wider intermediate than the output for every pair, so
+*  it does not fit the load / op / store scheme of apu_matrix_addsub_tile;
+*  only the hand written mul_08u, mul_08u_08u_16s, mul_08u_16s_16s and mul_16s
+*  exist. threshold maps one input to an 8 bit mask through its value pair
+*  port rather than combining two inputs; threshold_08u, _16u and _32u and
+*  their range variants cover the unsigned types, the signed ones are missing.
+***********************************************************************************/
+
+#ifndef ARITHMETICMATRIXACF_H
+#define ARITHMETICMATRIXACF_H
+
+#define INPUT_0   "INPUT_0"
+#define INPUT_1   "INPUT_1"
+#define INPUT_2   "INPUT_2"
+#define OUTPUT_0  "OUTPUT_0"
+
+#define ARITHMETIC_MATRIX_ADD_LIST(X) \
+   X(add, 08u, 08s, 16s) \
+   X(add, 08u, 16u, 16u) \
+   X(add, 08u, 32u, 32u) \
+   X(add, 08u, 32s, 32s) \
+   X(add, 08s, 08u, 16s) \
+   X(add, 08s, 16u, 32s) \
+   X(add, 08s, 16s, 16s) \
+   X(add, 08s, 32u, 32s) \
+   X(add, 08s, 32s, 32s) \
+   X(add, 16u, 08u, 16u) \
+   X(add, 16u, 08s, 32s) \
+   X(add, 16u, 16s, 32s) \
+   X(add, 16u, 32u, 32u) \
+   X(add, 16u, 32s, 32s) \
+   X(add, 16s, 08u, 16s) \
+   X(add, 16s, 08s, 16s) \
+   X(add, 16s, 16u, 32s) \
+   X(add, 16s, 32u, 32s) \
+   X(add, 16s, 32s, 32s) \
+   X(add, 32u, 08u, 32u) \
+   X(add, 32u, 08s, 32s) \
+   X(add, 32u, 16u, 32u) \
+   X(add, 32u, 16s, 32s) \
+   X(add, 32u, 32s, 32s) \
+   X(add, 32s, 08u, 32s) \
+   X(add, 32s, 08s, 32s) \
+   X(add, 32s, 16u, 32s) \
+   X(add, 32s, 16s, 32s) \
+   X(add, 32s, 32u, 32s)
+
+#define ARITHMETIC_MATRIX_SUB_LIST(X) \
+   X(sub, 08u, 08s, 16s) \
+   X(sub, 08u, 16u, 16u) \
+   X(sub, 08u, 32u, 32u) \
+   X(sub, 08u, 32s, 32s) \
+   X(sub, 08s, 08u, 16s) \
+   X(sub, 08s, 16u, 32s) \
+   X(sub, 08s, 16s, 16s) \
+   X(sub, 08s, 32u, 32s) \
+   X(sub, 08s, 32s, 32s) \
+   X(sub, 16u, 08u, 16u) \
+   X(sub, 16u, 08s, 32s) \
+   X(sub, 16u, 16s, 32s) \
+   X(sub, 16u, 32u, 32u) \
+   X(sub, 16u, 32s, 32s) \
+   X(sub, 16s, 08s, 16s) \
+   X(sub, 16s, 16u, 32s) \
+   X(sub, 16s, 32u, 32s) \
+   X(sub, 16s, 32s, 32s) \
+   X(sub, 32u, 08u, 32u) \
+   X(sub, 32u, 08s, 32s) \
+   X(sub, 32u, 16u, 32u) \
+   X(sub, 32u, 16s, 32s) \
+   X(sub, 32u, 32s, 32s) \
+   X(sub, 32s, 08u, 32s) \
+   X(sub, 32s, 08s, 32s) \
+   X(sub, 32s, 16u, 32s) \
+   X(sub, 32s, 16s, 32s) \
+   X(sub, 32s, 32u, 32s)
+
+#define ARITHMETIC_MATRIX_POLICY_SAME_TYPE_LIST(X) \
+   X(add, 08s) \
+   X(add, 16u) \
+   X(add, 32u) \
+   X(add, 32s) \
+   X(sub, 08s) \
+   X(sub, 16u) \
+   X(sub, 32u) \
+   X(sub, 32s)
+
+#define ARITHMETIC_MATRIX_SAME_TYPE_LIST(X) \
+   X(and, 08s) \
+   X(and, 16s) \
+   X(and, 32s) \
+   X(or, 08s) \
+   X(or, 16s) \
+   X(or, 32s) \
+   X(xor, 08s) \
+   X(xor, 16s) \
+   X(xor, 32s) \
+   X(absdiff, 08s) \
+   X(absdiff, 16u) \
+   X(absdiff, 32u) \
+   X(absdiff, 32s) \
+   X(max, 08s) \
+   X(max, 16u) \
+   X(max, 32u) \
+   X(max, 32s) \
+   X(min, 08s) \
+   X(min, 16u) \
+   X(min, 32u) \
+   X(min, 32s)
+
+#endif /* ARITHMETICMATRIXACF_H */
@@ -0,0 +1,374 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file arithmetic_matrix_apu.h
+*  @brief Type-generic APU implementation of the arithmetic type-matrix kernels
+*
+*  add/sub evaluate the exact result of any two operand types as a low word
+*  plus a small high word (sign extension and carry), then wrap or saturate it
+*  to the output type. The words are native 16 bit lanes when the inputs and
+*  the output are at most 16 bit wide, 32 bit otherwise. The other operations
+*  work on the 16 or 32 bit vector type the element widens to.
+***********************************************************************************/
+
+#ifndef APUARITHMETICMATRIXIMPL_H
+#define APUARITHMETICMATRIXIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Per element type properties used by the type-matrix kernels
+*
+*  work is the vector type the element is loaded into, uwork its unsigned
+*  counterpart; kMin/kMax is the range of the element (unused for 32u).
+***********************************************************************************/
+template<typename T> struct apu_matrix_traits;
+
+template<> struct apu_matrix_traits<vec08u>
+{
+   typedef vec16u work;
+   typedef vec16u uwork;
+   static const bool   kSigned = false;
+   static const int    kBits   = 8;
+   static const int32s kMin    = 0;
+   static const int32s kMax    = 255;
+};
+
+template<> struct apu_matrix_traits<vec08s>
+{
+   typedef vec16s work;
+   typedef vec16u uwork;
+   static const bool   kSigned = true;
+   static const int    kBits   = 8;
+   static const int32s kMin    = -128;
+   static const int32s kMax    = 127;
+};
+
+template<> struct apu_matrix_traits<vec16u>
+{
+   typedef vec16u work;
+   typedef vec16u uwork;
+   static const bool   kSigned = false;
+   static const int    kBits   = 16;
+   static const int32s kMin    = 0;
+   static const int32s kMax    = 65535;
+};
+
+template<> struct apu_matrix_traits<vec16s>
+{
+   typedef vec16s work;
+   typedef vec16u uwork;
+   static const bool   kSigned = true;
+   static const int    kBits   = 16;
+   static const int32s kMin    = -32768;
+   static const int32s kMax    = 32767;
+};
+
+template<> struct apu_matrix_traits<vec32u>
+{
+   typedef vec32u work;
+   typedef vec32u uwork;
+   static const bool   kSigned = false;
+   static const int    kBits   = 32;
+   static const int32s kMin    = 0;
+   static const int32s kMax    = 0;
+};
+
+template<> struct apu_matrix_traits<vec32s>
+{
+   typedef vec32s work;
+   typedef vec32u uwork;
+   static const bool   kSigned = true;
+   static const int    kBits   = 32;
+   static const int32s kMin    = (-2147483647 - 1);
+   static const int32s kMax    = 2147483647;
+};
+
+/*!*********************************************************************************
+*  \brief Word types of the exact add/sub result, 16 or 32 bit
+***********************************************************************************/
+template<int BITS> struct apu_matrix_word;
+
+template<> struct apu_matrix_word<16>
+{
+   typedef vec16u lo;
+   typedef vec16s hi;
+};
+
+template<> struct apu_matrix_word<32>
+{
+   typedef vec32u lo;
+   typedef vec32s hi;
+};
+
+/*!*********************************************************************************
+*  \brief Word width needed by an add/sub of TA and TB into TO
+***********************************************************************************/
+template<typename TO, typename TA, typename TB>
+struct apu_matrix_width
+{
+   static const int kBits = (apu_matrix_traits<TA>::kBits == 32 ||
+                             apu_matrix_traits<TB>::kBits == 32 ||
+                             apu_matrix_traits<TO>::kBits == 32) ? 32 : 16;
+};
+
+/*!*********************************************************************************
+*  \brief Loads an element as low word and sign extension word (0 or -1)
+***********************************************************************************/
+template<int BITS, typename T>
+inline void apu_matrix_load(T v,
+                            typename apu_matrix_word<BITS>::lo& lo,
+                            typename apu_matrix_word<BITS>::hi& hi)
+{
+   typedef typename apu_matrix_word<BITS>::lo LO;
+   typedef typename apu_matrix_word<BITS>::hi HI;
+
+   HI lW = __builtin_convertvector(v, HI);
+   lo = __builtin_convertvector(lW, LO);
+   if (apu_matrix_traits<T>::kSigned)
+   {
+      hi = lW >> (HI)(BITS - 1);
+   }
+   else
+   {
+      hi = 0;
+   }
+}
+
+/*!*********************************************************************************
+*  \brief Converts the exact value hi:lo to the output type
+*  \tparam SAT true: clamp to the range of TO, false: keep the low bits
+***********************************************************************************/
+template<int BITS, bool SAT, typename TO>
+inline TO apu_matrix_store(typename apu_matrix_word<BITS>::lo lo,
+                           typename apu_matrix_word<BITS>::hi hi)
+{
+   typedef typename apu_matrix_word<BITS>::lo LO;
+   typedef typename apu_matrix_word<BITS>::hi HI;
+
+   if (!SAT)
+   {
+      return __builtin_convertvector(lo, TO);
+   }
+
+   HI    lZero = 0;
+   vbool lNeg  = vslt(hi, lZero);
+
+   // an unsigned output as wide as the word does not fit the signed clamp
+   if (!apu_matrix_traits<TO>::kSigned && apu_matrix_traits<TO>::kBits == BITS)
+   {
+      LO lLimit = vselect((LO)0, ~(LO)0, lNeg);
+      return __builtin_convertvector(vselect(lo, lLimit, vseq(hi, lZero)), TO);
+   }
+
+   HI    lMin  = (HI)(apu_matrix_traits<TO>::kMin);
+   HI    lMax  = (HI)(apu_matrix_traits<TO>::kMax);
+   HI    lVal  = __builtin_convertvector(lo, HI);
+   vbool lFits = vseq(hi, lVal >> (HI)(BITS - 1)); // hi:lo is a valid signed word
+
+   lVal = vselect(lMax, lVal, vsgt(lVal, lMax));
+   lVal = vselect(lMin, lVal, vslt(lVal, lMin));
+   lVal = vselect(lVal, vselect(lMin, lMax, lNeg), lFits);
+   return __builtin_convertvector(lVal, TO);
+}
+
+/*!*********************************************************************************
+*  \brief Exact addition: lo wraps, the carry goes to hi
+***********************************************************************************/
+struct MatrixAdd
+{
+   template<typename LO, typename HI>
+   void operator()(LO a, HI ah, LO b, HI bh, LO& lo, HI& hi) const
+   {
+      lo = a + b;
+      hi = ah + bh + vselect((HI)1, (HI)0, vslt(lo, a));
+   }
+};
+
+/*!*********************************************************************************
+*  \brief Exact subtraction: lo wraps, the borrow goes to hi
+***********************************************************************************/
+struct MatrixSub
+{
+   template<typename LO, typename HI>
+   void operator()(LO a, HI ah, LO b, HI bh, LO& lo, HI& hi) const
+   {
+      lo = a - b;
+      hi = ah - bh - vselect((HI)1, (HI)0, vslt(a, b));
+   }
+};
+
+/*!*********************************************************************************
+*  \brief Addition or subtraction (OP) of any two element types
+***********************************************************************************/
+template<typename OP, bool SAT, typename TO, typename TA, typename TB>
+static void apu_matrix_addsub_tile(TO* dst, int dstr,
+                                   const TA* srcA, int sstrA,
+                                   const TB* srcB, int sstrB,
+                                   int bw, int bh)
+{
+   const int kBits = apu_matrix_width<TO, TA, TB>::kBits;
+   typedef typename apu_matrix_word<kBits>::lo LO;
+   typedef typename apu_matrix_word<kBits>::hi HI;
+   OP lOp;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         LO lLoA, lLoB, lLo;
+         HI lHiA, lHiB, lHi;
+         apu_matrix_load<kBits>(srcA[x], lLoA, lHiA);
+         apu_matrix_load<kBits>(srcB[x], lLoB, lHiB);
+         lOp(lLoA, lHiA, lLoB, lHiB, lLo, lHi);
+         dst[x] = apu_matrix_store<kBits, SAT, TO>(lLo, lHi);
+      }
+      dst  += dstr;
+      srcA += sstrA;
+      srcB += sstrB;
+   }
+}
+
+/*!*********************************************************************************
+*  \brief Addition of any two element types with wrap or saturate policy
+***********************************************************************************/
+template<typename TO, typename TA, typename TB>
+void apu_matrix_add(TO* dst, int dstr,
+                    const TA* srcA, int sstrA,
+                    const TB* srcB, int sstrB,
+                    int bw, int bh, bool lSaturate)
+{
+   if (lSaturate)
+   {
+      apu_matrix_addsub_tile<MatrixAdd, true>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+   }
+   else
+   {
+      apu_matrix_addsub_tile<MatrixAdd, false>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+   }
+}
+
+/*!*********************************************************************************
+*  \brief Subtraction of any two element types with wrap or saturate policy
+***********************************************************************************/
+template<typename TO, typename TA, typename TB>
+void apu_matrix_sub(TO* dst, int dstr,
+                    const TA* srcA, int sstrA,
+                    const TB* srcB, int sstrB,
+                    int bw, int bh, bool lSaturate)
+{
+   if (lSaturate)
+   {
+      apu_matrix_addsub_tile<MatrixSub, true>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+   }
+   else
+   {
+      apu_matrix_addsub_tile<MatrixSub, false>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+   }
+}
+
+/*!*********************************************************************************
+*  \brief Operations of the same type kernels, on the work type of T
+***********************************************************************************/
+template<typename T>
+struct MatrixMin
+{
+   typedef typename apu_matrix_traits<T>::work W;
+   W operator()(W a, W b) const { return vselect(b, a, vsgt(a, b)); }
+};
+
+template<typename T>
+struct MatrixMax
+{
+   typedef typename apu_matrix_traits<T>::work W;
+   W operator()(W a, W b) const { return vselect(a, b, vsgt(a, b)); }
+};
+
+template<typename T>
+struct MatrixAbsdiff
+{
+   typedef typename apu_matrix_traits<T>::work  W;
+   typedef typename apu_matrix_traits<T>::uwork UW;
+   W operator()(W a, W b) const
+   {
+      vbool lGt   = vsgt(a, b);
+      UW    lDiff = __builtin_convertvector(vselect(a, b, lGt), UW) -
+                    __builtin_convertvector(vselect(b, a, lGt), UW);
+      if (apu_matrix_traits<T>::kSigned)
+      {
+         UW lMax = (UW)(apu_matrix_traits<T>::kMax); // saturate to the range of T
+         lDiff = vselect(lMax, lDiff, vsgt(lDiff, lMax));
+      }
+      return __builtin_convertvector(lDiff, W);
+   }
+};
+
+template<typename T>
+struct MatrixAnd
+{
+   typedef typename apu_matrix_traits<T>::work W;
+   W operator()(W a, W b) const { return a & b; }
+};
+
+template<typename T>
+struct MatrixOr
+{
+   typedef typename apu_matrix_traits<T>::work W;
+   W operator()(W a, W b) const { return a | b; }
+};
+
+template<typename T>
+struct MatrixXor
+{
+   typedef typename apu_matrix_traits<T>::work W;
+   W operator()(W a, W b) const { return a ^ b; }
+};
+
+/*!*********************************************************************************
+*  \brief Element-wise operation OP of one element type
+***********************************************************************************/
+template<template<typename> class OP, typename T>
+void apu_matrix_binary(T* dst, int dstr,
+                       const T* srcA, int sstrA,
+                       const T* srcB, int sstrB,
+                       int bw, int bh)
+{
+   typedef typename apu_matrix_traits<T>::work W;
+   OP<T> lOp;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         W lA = __builtin_convertvector(srcA[x], W);
+         W lB = __builtin_convertvector(srcB[x], W);
+         dst[x] = __builtin_convertvector(lOp(lA, lB), T);
+      }
+      dst  += dstr;
+      srcA += sstrA;
+      srcB += sstrB;
+   }
+}
+
+#endif /* APUARITHMETICMATRIXIMPL_H */
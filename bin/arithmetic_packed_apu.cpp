@@ -0,0 +1,89 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file arithmetic_packed_apu.cpp
+*  @brief Packed (two pixels per 16 bit lane) APU implementation of the 08u
+*         arithmetic kernels, built on the vec08x2 intrinsics
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "arithmetic_packed_apu.h"
+
+/*!*********************************************************************************
+*  \brief Runs a packed binary operation over a tile, bw / 2 lanes per line
+***********************************************************************************/
+template<typename OP>
+static void apu_packed_binary(vec08u* dst, int dstr,
+                              const vec08u* srcA, int sstrA,
+                              const vec08u* srcB, int sstrB,
+                              int bw, int bh)
+{
+   int lPairs = bw >> 1;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < lPairs; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vstore_08x2(dst, x, OP::op(vload_08x2(srcA, x), vload_08x2(srcB, x)));
+      }
+      dst  += dstr;
+      srcA += sstrA;
+      srcB += sstrB;
+   }
+}
+
+/* Operations of the packed loop */
+struct packed_add      { static vec08x2 op(vec08x2 a, vec08x2 b) { return vadd_08x2(a, b); } };
+struct packed_sub      { static vec08x2 op(vec08x2 a, vec08x2 b) { return vsub_08x2(a, b); } };
+struct packed_and      { static vec08x2 op(vec08x2 a, vec08x2 b) { return a & b; } };
+struct packed_or       { static vec08x2 op(vec08x2 a, vec08x2 b) { return a | b; } };
+struct packed_xor      { static vec08x2 op(vec08x2 a, vec08x2 b) { return a ^ b; } };
+
+void apu_add_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh)
+{
+   apu_packed_binary<packed_add>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+}
+
+void apu_sub_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh)
+{
+   apu_packed_binary<packed_sub>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+}
+
+void apu_and_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh)
+{
+   apu_packed_binary<packed_and>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+}
+
+void apu_or_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh)
+{
+   apu_packed_binary<packed_or>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+}
+
+void apu_xor_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh)
+{
+   apu_packed_binary<packed_xor>(dst, dstr, srcA, sstrA, srcB, sstrB, bw, bh);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
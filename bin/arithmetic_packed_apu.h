@@ -0,0 +1,61 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file arithmetic_packed_apu.h
+*  @brief Packed (two pixels per 16 bit lane) APU implementation of the 08u
+*         arithmetic kernels
+*
+*  All functions take the usual unsigned 8 bit tiles; bw, the strides and the
+*  buffer addresses must be even. The arithmetic wrappers select these paths
+*  automatically when the tile geometry allows it.
+*
+*  Only operations that map to one or two 16 bit ALU operations per pixel pair
+*  are packed. Saturating add / sub, absdiff, min and max need byte masking
+*  worth several times the native per-pixel cost and stay on the unpacked
+*  implementation.
+***********************************************************************************/
+
+#ifndef APUARITHMETICPACKEDIMPL_H
+#define APUARITHMETICPACKEDIMPL_H
+
+#include <stdint.h>
+
+void apu_add_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh);
+void apu_sub_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh);
+void apu_and_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh);
+void apu_or_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh);
+void apu_xor_08x2(vec08u* dst, int dstr, const vec08u* srcA, int sstrA, const vec08u* srcB, int sstrB, int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief True if a tile can be processed two pixels per lane
+*  \param bw    chunk width in pixels
+*  \param lSpan bitwise or of all chunkSpan values of the kernel ports
+*  \param lAddr bitwise or of all buffer addresses of the kernel ports
+***********************************************************************************/
+static inline bool apu_packed_08x2_ok(int bw, int lSpan, uintptr_t lAddr)
+{
+   return (((bw | lSpan) & 1) == 0) && ((lAddr & 1) == 0);
+}
+
+#endif /* APUARITHMETICPACKEDIMPL_H */
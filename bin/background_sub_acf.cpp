@@ -0,0 +1,158 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file background_sub_acf.cpp
+* \addtogroup apexcv-background_sub
+* \addtogroup background_sub
+* \ingroup background_sub
+* @{
+* \brief background subtraction
+*/
+
+/*!*********************************************************************************
+*  @file background_sub_acf.cpp
+*  @brief ACF metadata and wrapper function for the background subtraction kernel
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "background_sub_acf.h"
+#include "inplace_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the background subtraction kernel (unsigned 8 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(BACKGROUND_SUB_08u_K)
+(
+   BACKGROUND_SUB_08u_KN,
+   7,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(3),
+          __identifier(ALPHA),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(4),
+          __identifier(INPUT_3),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(5),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(6),
+          __identifier(OUTPUT_1),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief Ports of the background subtraction kernel that may be bound to one buffer
+*
+*  The background model is meant to be updated in place across frames.
+***********************************************************************************/
+const ACF_INPLACE_PORT_PAIR gBackgroundSubInplacePorts[] =
+{
+   { BACKGROUND_SUB_08u_KN, 1, 6 },
+};
+const int gBackgroundSubInplacePortsCount = sizeof(gBackgroundSubInplacePorts) / sizeof(gBackgroundSubInplacePorts[0]);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "background_sub_acf.h"
+#include "background_sub_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the background subtraction kernel
+*
+*  Replaces absdiff_08u -> threshold_08u plus accumulate_weighted_08u.
+*  INPUT_0 is the frame, INPUT_1 / OUTPUT_1 the background model, OUTPUT_0 the
+*  foreground mask. INPUT_2[0] is the difference threshold and INPUT_2[1]
+*  enables the selective update (foreground pixels are not learnt); ALPHA is
+*  the learning rate in Q15; INPUT_3 holds the foreground and background mask
+*  values, in the order of the output values of threshold_08u.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void background_subtract_08u(kernel_io_desc lIn0, kernel_io_desc lBg, kernel_io_desc lParams, kernel_io_desc lAlpha, kernel_io_desc lOutVals, kernel_io_desc lOut0, kernel_io_desc lOutBg)
+{
+   vec08u*   lpvIn0    = (vec08u*)lIn0.pMem;
+   vec08u*   lpvBg     = (vec08u*)lBg.pMem;
+   uint8_t*  lpParams  = (uint8_t*)lParams.pMem;
+   uint16_t* lpAlpha   = (uint16_t*)lAlpha.pMem;
+   uint8_t*  lpOutVals = (uint8_t*)lOutVals.pMem;
+   vec08u*   lpvOut0   = (vec08u*)lOut0.pMem;
+   vec08u*   lpvOutBg  = (vec08u*)lOutBg.pMem;
+
+   apu_background_subtract( lpvOut0, lOut0.chunkSpan,
+                            lpvOutBg, lOutBg.chunkSpan,
+                            lpvIn0, lIn0.chunkSpan,
+                            lpvBg, lBg.chunkSpan,
+                            lIn0.chunkWidth, lIn0.chunkHeight,
+                            lpParams[0], lpOutVals[0], lpOutVals[1],
+                            lpAlpha[0], lpParams[1] != 0 );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
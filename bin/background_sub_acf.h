@@ -0,0 +1,43 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file background_sub_acf.h
+*  @brief Kernel identifiers for the background subtraction kernel
+***********************************************************************************/
+
+#ifndef BACKGROUNDSUBACF_H
+#define BACKGROUNDSUBACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define INPUT_1                         "INPUT_1"
+#define INPUT_2                         "INPUT_2"
+#define INPUT_3                         "INPUT_3"
+#define OUTPUT_0                        "OUTPUT_0"
+#define OUTPUT_1                        "OUTPUT_1"
+#define ALPHA                           "ALPHA"
+
+#define BACKGROUND_SUB_08u_K            background_subtract_08u
+#define BACKGROUND_SUB_08u_KN           "background_subtract_08u"
+
+#endif /* BACKGROUNDSUBACF_H */
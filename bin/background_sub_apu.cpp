@@ -0,0 +1,79 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file background_sub_apu.cpp
+*  @brief APU implementation of the background subtraction kernel
+*
+*  Fuses absdiff_08u, threshold_08u and accumulate_weighted_08u: the frame and
+*  the background are each read once per pixel.
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "background_sub_apu.h"
+
+void apu_background_subtract(vec08u* dstMask, int dmstr,
+                             vec08u* dstBg, int dbstr,
+                             const vec08u* src, int sstr,
+                             const vec08u* srcBg, int sbstr,
+                             int bw, int bh,
+                             uint8_t lThreshold, uint8_t lFgVal, uint8_t lBgVal,
+                             uint16_t lAlpha, bool lSelective)
+{
+   vec16u lvThreshold = lThreshold;
+   vec16u lvFgVal     = lFgVal;
+   vec16u lvBgVal     = lBgVal;
+   vec16s lvAlpha     = (lAlpha > 32767) ? 32767 : lAlpha;
+   vec16s lvRound     = 1 << 14;
+   vbool  lLearnAll   = vseq((vec16s)(lSelective ? 1 : 0), (vec16s)0);
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16s lX  = __builtin_convertvector(src[x], vec16s);
+         vec16s lBg = __builtin_convertvector(srcBg[x], vec16s);
+         vec16s lD  = lX - lBg;
+
+         vbool lFg  = vsgt(vabs(lD), lvThreshold);
+         dstMask[x] = __builtin_convertvector(vselect(lvFgVal, lvBgVal, lFg), vec08u);
+
+         vacc32s lAcc;
+         vacc_clear(&lAcc);
+         vacc_acl(&lAcc, lvRound);
+         vacc_mac(&lAcc, lD, lvAlpha);
+         vec16s lNewBg = lBg + vacc_narrow(lAcc, 15);
+
+         /* selective update: keep the old background under foreground pixels */
+         vec16s lKeep = vselect(lBg, lNewBg, lFg);
+         dstBg[x] = __builtin_convertvector(vselect(lNewBg, lKeep, lLearnAll), vec08u);
+      }
+      src     += sstr;
+      srcBg   += sbstr;
+      dstMask += dmstr;
+      dstBg   += dbstr;
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
@@ -0,0 +1,65 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file background_sub_apu.h
+*  @brief APU implementation of the background subtraction kernel
+***********************************************************************************/
+
+#ifndef APUBACKGROUNDSUBIMPL_H
+#define APUBACKGROUNDSUBIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Foreground mask and running background update in one pass
+*
+*  Per pixel: fg = |x - bg| > lThreshold, mask = fg ? lFgVal : lBgVal and
+*  bg += alpha * (x - bg) (rounded, alpha in Q15). With lSelective set the
+*  background of foreground pixels is left unchanged. dstBg may equal srcBg.
+*
+*  \param dstMask    foreground mask
+*  \param dmstr      mask stride
+*  \param dstBg      updated background
+*  \param dbstr      background output stride
+*  \param src        current frame
+*  \param sstr       frame stride
+*  \param srcBg      background model
+*  \param sbstr      background input stride
+*  \param bw         chunk width
+*  \param bh         chunk height
+*  \param lThreshold absolute difference threshold
+*  \param lFgVal     mask value of foreground pixels
+*  \param lBgVal     mask value of background pixels
+*  \param lAlpha     learning rate in Q15 (32768 = 1.0)
+*  \param lSelective do not learn foreground pixels
+***********************************************************************************/
+void apu_background_subtract(vec08u* dstMask, int dmstr,
+                             vec08u* dstBg, int dbstr,
+                             const vec08u* src, int sstr,
+                             const vec08u* srcBg, int sbstr,
+                             int bw, int bh,
+                             uint8_t lThreshold, uint8_t lFgVal, uint8_t lBgVal,
+                             uint16_t lAlpha, bool lSelective);
+
+#endif /* APUBACKGROUNDSUBIMPL_H */
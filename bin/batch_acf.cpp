@@ -0,0 +1,180 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file batch_acf.cpp
+* \addtogroup apexcv-batch
+* \addtogroup batch
+* \ingroup batch
+* @{
+* \brief batched small image processing
+*/
+
+/*!*********************************************************************************
+*  @file batch_acf.cpp
+*  @brief ACF metadata and wrapper functions for the batched small image kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "batch_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the batched image sum kernel (unsigned 8 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(BATCH_SUM_08u_K)
+(
+   BATCH_SUM_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(LAYOUT),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(SUMS),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(BATCH_MAX_IMAGES, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the batched squared image sum kernel (unsigned 8 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(BATCH_SUM_SQRD_08u_K)
+(
+   BATCH_SUM_SQRD_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(LAYOUT),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(SUMS),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(BATCH_MAX_IMAGES, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "batch_acf.h"
+#include "batch_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the batched image sum kernel (unsigned 8 bit)
+*
+*  INPUT_0 holds a batch of images side by side (see batch_apu.h), LAYOUT[0] is
+*  the number of CUs per image; a tile with LAYOUT[0] == 0 is not processed and
+*  leaves SUMS at zero. SUMS[k] is the pixel sum of image k over the frame, e.g.
+*  for a per-image mean.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void batch_sum_08u(kernel_io_desc lIn0, kernel_io_desc lLayout, kernel_io_desc lSums)
+{
+   vec08u*   lpvIn0   = (vec08u*)lIn0.pMem;
+   uint16_t* lpLayout = (uint16_t*)lLayout.pMem;
+   uint32_t* lpSums   = (uint32_t*)lSums.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      for (int i = 0; i < BATCH_MAX_IMAGES; ++i)
+      {
+         lpSums[i] = 0;
+      }
+   }
+   if (lpLayout[0] == 0)
+   {
+      return;
+   }
+   apu_batch_sum( lpSums,
+                  lpvIn0, lIn0.chunkSpan,
+                  lIn0.chunkWidth, lIn0.chunkHeight,
+                  lpLayout[0] );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the batched squared image sum kernel (unsigned 8 bit)
+*  \see batch_sum_08u
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void batch_sum_squared_08u(kernel_io_desc lIn0, kernel_io_desc lLayout, kernel_io_desc lSums)
+{
+   vec08u*   lpvIn0   = (vec08u*)lIn0.pMem;
+   uint16_t* lpLayout = (uint16_t*)lLayout.pMem;
+   uint32_t* lpSums   = (uint32_t*)lSums.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      for (int i = 0; i < BATCH_MAX_IMAGES; ++i)
+      {
+         lpSums[i] = 0;
+      }
+   }
+   if (lpLayout[0] == 0)
+   {
+      return;
+   }
+   apu_batch_sum_squared( lpSums,
+                          lpvIn0, lIn0.chunkSpan,
+                          lIn0.chunkWidth, lIn0.chunkHeight,
+                          lpLayout[0] );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
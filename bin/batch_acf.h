@@ -0,0 +1,49 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file batch_acf.h
+*  @brief Kernel identifiers for the batched small image kernels
+***********************************************************************************/
+
+#ifndef BATCHACF_H
+#define BATCHACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define LAYOUT                          "LAYOUT"
+#define SUMS                            "SUMS"
+
+#ifndef APU_VSIZE
+#define APU_VSIZE                       32
+#endif
+
+/*! Images per batch the per-image result ports can hold: one per CU at most */
+#define BATCH_MAX_IMAGES                APU_VSIZE
+
+#define BATCH_SUM_08u_K                 batch_sum_08u
+#define BATCH_SUM_08u_KN                "batch_sum_08u"
+
+#define BATCH_SUM_SQRD_08u_K            batch_sum_squared_08u
+#define BATCH_SUM_SQRD_08u_KN           "batch_sum_squared_08u"
+
+#endif /* BATCHACF_H */
@@ -0,0 +1,93 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file batch_apu.cpp
+*  @brief APU implementation of the batched small image kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "batch_apu.h"
+#include "batch_acf.h"
+
+/*!*********************************************************************************
+*  \brief Adds the per-CU partial sums to the sum of the image each CU belongs to
+***********************************************************************************/
+static void batch_segment_add(uint32_t* lpSums, vec32u lvSum, int lCUsPerImage)
+{
+   int lCUs   = apuGetNumberOfCUs();
+   int lImage = 0;
+   int lCU    = 0;
+
+   for (int i = 0; i < lCUs; ++i) chess_loop_range(1,)
+   {
+      lpSums[lImage] += (uint32_t)vget(lvSum, i);
+      if (++lCU == lCUsPerImage)
+      {
+         lCU = 0;
+         ++lImage;
+      }
+   }
+}
+
+void apu_batch_sum(uint32_t* lpSums,
+                   const vec08u* src, int sstr,
+                   int bw, int bh,
+                   int lCUsPerImage)
+{
+   vacc32u lAcc;
+   vacc_clear(&lAcc);
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vacc_acl(&lAcc, __builtin_convertvector(src[x], vec16u));
+      }
+      src += sstr;
+   }
+   batch_segment_add(lpSums, vacc_get(lAcc), lCUsPerImage);
+}
+
+void apu_batch_sum_squared(uint32_t* lpSums,
+                           const vec08u* src, int sstr,
+                           int bw, int bh,
+                           int lCUsPerImage)
+{
+   vacc32u lAcc;
+   vacc_clear(&lAcc);
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lPix = __builtin_convertvector(src[x], vec16u);
+         vacc_acl(&lAcc, lPix * lPix); // 255^2 still fits the 16 bit lane
+      }
+      src += sstr;
+   }
+   batch_segment_add(lpSums, vacc_get(lAcc), lCUsPerImage);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
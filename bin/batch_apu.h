@@ -0,0 +1,72 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file batch_apu.h
+*  @brief APU implementation of the batched small image kernels
+*
+*  A batch of N small images of equal size is packed side by side into one frame,
+*  image k covering the CUs [k * C, (k + 1) * C) where C is the number of CUs per
+*  image (image width / chunk width). One graph launch then processes the whole
+*  batch: element-wise kernels need no change at all, kernels that reduce across
+*  the CU array have to keep the images apart, which the kernels below do.
+*
+*  Neighbourhood kernels (filters, morphology, census, ...) run on a batch too,
+*  but their spatial dependency reaches into the CUs of the adjacent images: the
+*  outermost columns of every image are computed from pixels of its neighbours
+*  instead of the border the image would have on its own. Pad each image with
+*  as many columns as the widest dependency in the graph, or ignore that border
+*  in the results.
+***********************************************************************************/
+
+#ifndef APUBATCHIMPL_H
+#define APUBATCHIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Adds the pixel sum of every image of the batch in the tile to lpSums
+*
+*  \param lpSums        per image sums, BATCH_MAX_IMAGES entries
+*  \param src           input tile
+*  \param sstr          stride in vec08u elements
+*  \param bw            chunk width
+*  \param bh            chunk height
+*  \param lCUsPerImage  CUs covered by one image, at least 1
+***********************************************************************************/
+void apu_batch_sum(uint32_t* lpSums,
+                   const vec08u* src, int sstr,
+                   int bw, int bh,
+                   int lCUsPerImage);
+
+/*!*********************************************************************************
+*  \brief As apu_batch_sum(), for the sum of the squared pixels
+*
+*  The 32 bit sums do not overflow for images up to 66051 pixels (257x257).
+***********************************************************************************/
+void apu_batch_sum_squared(uint32_t* lpSums,
+                           const vec08u* src, int sstr,
+                           int bw, int bh,
+                           int lCUsPerImage);
+
+#endif /* APUBATCHIMPL_H */
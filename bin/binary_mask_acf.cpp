@@ -0,0 +1,536 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file binary_mask_acf.cpp
+* \addtogroup apexcv-binary_mask
+* \addtogroup binary_mask
+* \ingroup binary_mask
+* @{
+* \brief bit-packed binary masks (one bit per pixel)
+*/
+
+/*!*********************************************************************************
+*  @file binary_mask_acf.cpp
+*  @brief ACF metadata and wrapper functions for the bit-packed binary mask kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "binary_mask_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the binary threshold kernel (unsigned 8 bit in, packed mask out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(THRESH_08u_1u_K)
+(
+   THRESH_08u_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(BINARY_MASK_WORD_BITS, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the range threshold kernel (unsigned 8 bit in, packed mask out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(THRESH_RANGE_08u_1u_K)
+(
+   THRESH_RANGE_08u_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(BINARY_MASK_WORD_BITS, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the mask pack kernel (byte mask in, packed mask out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(PACK_08u_1u_K)
+(
+   PACK_08u_1u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(BINARY_MASK_WORD_BITS, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the mask unpack kernel (packed mask in, byte mask out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(UNPACK_1u_08u_K)
+(
+   UNPACK_1u_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(BINARY_MASK_WORD_BITS, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the bitwise and kernel (packed masks)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(AND_1u_K)
+(
+   AND_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the bitwise or kernel (packed masks)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(OR_1u_K)
+(
+   OR_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the bitwise xor kernel (packed masks)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(XOR_1u_K)
+(
+   XOR_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the bitwise not kernel (packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(NOT_1u_K)
+(
+   NOT_1u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the mask count kernel (packed mask in, per CU pixel count out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(COUNT_1u_K)
+(
+   COUNT_1u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier("VEC_COUNT"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the mask count kernel on frames not a multiple of the CU array width
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(COUNT_RAGGED_1u_K)
+(
+   COUNT_RAGGED_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier("WIDTH"),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_COUNT"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "binary_mask_acf.h"
+#include "binary_mask_apu.h"
+#include "ragged_tile_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the binary threshold kernel (packed mask out)
+*
+*  Sets the bit of every pixel greater than the threshold.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void threshold_08u_1u(kernel_io_desc lIn0, kernel_io_desc lThreshold, kernel_io_desc lOut0)
+{
+   vec08u*  lpvIn0       = (vec08u*)lIn0.pMem;
+   uint8_t* lpvThreshold = (uint8_t*)lThreshold.pMem;
+   vec16u*  lpvOut0      = (vec16u*)lOut0.pMem;
+
+   apu_threshold_packed( lpvOut0, lOut0.chunkSpan / 2,
+                         lpvIn0, lIn0.chunkSpan,
+                         lIn0.chunkWidth, lIn0.chunkHeight,
+                         lpvThreshold[0] );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the range threshold kernel (packed mask out)
+*
+*  Sets the bit of every pixel inside [lower, upper], given as INPUT_1[0] and
+*  INPUT_1[1] like threshold_range_08u.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void threshold_range_08u_1u(kernel_io_desc lIn0, kernel_io_desc lThreshold, kernel_io_desc lOut0)
+{
+   vec08u*  lpvIn0       = (vec08u*)lIn0.pMem;
+   uint8_t* lpvThreshold = (uint8_t*)lThreshold.pMem;
+   vec16u*  lpvOut0      = (vec16u*)lOut0.pMem;
+
+   apu_threshold_range_packed( lpvOut0, lOut0.chunkSpan / 2,
+                               lpvIn0, lIn0.chunkSpan,
+                               lIn0.chunkWidth, lIn0.chunkHeight,
+                               lpvThreshold[0], lpvThreshold[1] );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the mask pack kernel
+*
+*  Accepts the output of threshold_08u or any other byte mask (non zero is set).
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void pack_08u_1u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_mask_pack( lpvOut0, lOut0.chunkSpan / 2,
+                  lpvIn0, lIn0.chunkSpan,
+                  lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the mask unpack kernel
+*
+*  INPUT_1[0] is written for set pixels and INPUT_1[1] for clear ones, the same
+*  order as the output values of threshold_08u.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void unpack_1u_08u(kernel_io_desc lIn0, kernel_io_desc lOutVals, kernel_io_desc lOut0)
+{
+   vec16u*  lpvIn0    = (vec16u*)lIn0.pMem;
+   uint8_t* lpOutVals = (uint8_t*)lOutVals.pMem;
+   vec08u*  lpvOut0   = (vec08u*)lOut0.pMem;
+
+   apu_mask_unpack( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan / 2,
+                    lOut0.chunkWidth, lOut0.chunkHeight,
+                    lpOutVals[0], lpOutVals[1] );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the bitwise and kernel (packed masks)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void and_1u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvIn1  = (vec16u*)lIn1.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_mask_and( lpvOut0, lOut0.chunkSpan / 2,
+                   lpvIn0, lIn0.chunkSpan / 2,
+                   lpvIn1, lIn1.chunkSpan / 2,
+                   lIn0.chunkWidth * BINARY_MASK_WORD_BITS, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the bitwise or kernel (packed masks)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void or_1u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvIn1  = (vec16u*)lIn1.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_mask_or( lpvOut0, lOut0.chunkSpan / 2,
+                  lpvIn0, lIn0.chunkSpan / 2,
+                  lpvIn1, lIn1.chunkSpan / 2,
+                  lIn0.chunkWidth * BINARY_MASK_WORD_BITS, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the bitwise xor kernel (packed masks)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void xor_1u(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvIn1  = (vec16u*)lIn1.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_mask_xor( lpvOut0, lOut0.chunkSpan / 2,
+                   lpvIn0, lIn0.chunkSpan / 2,
+                   lpvIn1, lIn1.chunkSpan / 2,
+                   lIn0.chunkWidth * BINARY_MASK_WORD_BITS, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the bitwise not kernel (packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void not_1u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_mask_not( lpvOut0, lOut0.chunkSpan / 2,
+                 lpvIn0, lIn0.chunkSpan / 2,
+                 lIn0.chunkWidth * BINARY_MASK_WORD_BITS, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the mask count kernel
+*
+*  Each CU accumulates the set pixels of its chunks in VEC_COUNT over the frame;
+*  the count is cleared on the first tile. The frame total is the sum over all
+*  CUs.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void count_1u(kernel_io_desc lIn0, kernel_io_desc lvCount)
+{
+   vec16u* lpvIn0   = (vec16u*)lIn0.pMem;
+   vec32u* lpvCount = (vec32u*)lvCount.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      *lpvCount = 0;
+   }
+   apu_mask_count( lpvCount,
+                   lpvIn0, lIn0.chunkSpan / 2,
+                   lIn0.chunkWidth * BINARY_MASK_WORD_BITS, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the mask count kernel on ragged tiles
+*
+*  As count_1u, but only the first WIDTH[0] pixels of each row are counted, so
+*  the unused columns of the last CU chunks need not be cleared.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void count_ragged_1u(kernel_io_desc lIn0, kernel_io_desc lWidth, kernel_io_desc lvCount)
+{
+   vec16u*   lpvIn0   = (vec16u*)lIn0.pMem;
+   uint16_t* lpWidth  = (uint16_t*)lWidth.pMem;
+   vec32u*   lpvCount = (vec32u*)lvCount.pMem;
+   int       lBw      = lIn0.chunkWidth * BINARY_MASK_WORD_BITS;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      *lpvCount = 0;
+   }
+   apu_mask_count_ragged( lpvCount,
+                          lpvIn0, lIn0.chunkSpan / 2,
+                          lBw, lIn0.chunkHeight,
+                          apu_ragged_valid_columns(lpWidth[0], lBw) );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
@@ -0,0 +1,74 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file binary_mask_acf.h
+*  @brief Kernel identifiers for the bit-packed binary mask kernels
+*
+*  A packed mask holds one bit per pixel in 16 bit words: bit i of word x is
+*  pixel 16 * x + i of the CU chunk (LSB first). The 8 bit ports of the
+*  converting kernels therefore use an ek width of 16.
+***********************************************************************************/
+
+#ifndef BINARYMASKACF_H
+#define BINARYMASKACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define INPUT_1                         "INPUT_1"
+#define INPUT_2                         "INPUT_2"
+#define OUTPUT_0                        "OUTPUT_0"
+
+/*! Pixels per packed mask word */
+#define BINARY_MASK_WORD_BITS           16
+
+#define THRESH_08u_1u_K                 threshold_08u_1u
+#define THRESH_08u_1u_KN                "threshold_08u_1u"
+
+#define THRESH_RANGE_08u_1u_K           threshold_range_08u_1u
+#define THRESH_RANGE_08u_1u_KN          "threshold_range_08u_1u"
+
+#define PACK_08u_1u_K                   pack_08u_1u
+#define PACK_08u_1u_KN                  "pack_08u_1u"
+
+#define UNPACK_1u_08u_K                 unpack_1u_08u
+#define UNPACK_1u_08u_KN                "unpack_1u_08u"
+
+#define AND_1u_K                        and_1u
+#define AND_1u_KN                       "and_1u"
+
+#define OR_1u_K                         or_1u
+#define OR_1u_KN                        "or_1u"
+
+#define XOR_1u_K                        xor_1u
+#define XOR_1u_KN                       "xor_1u"
+
+#define NOT_1u_K                        not_1u
+#define NOT_1u_KN                       "not_1u"
+
+#define COUNT_1u_K                      count_1u
+#define COUNT_1u_KN                     "count_1u"
+
+#define COUNT_RAGGED_1u_K               count_ragged_1u
+#define COUNT_RAGGED_1u_KN              "count_ragged_1u"
+
+#endif /* BINARYMASKACF_H */
@@ -0,0 +1,261 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file binary_mask_apu.cpp
+*  @brief APU implementation of the bit-packed binary mask kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "binary_mask_apu.h"
+#include "binary_mask_acf.h"
+
+/*!*********************************************************************************
+*  \brief Builds one mask word from 16 adjacent pixels, bit i set where OP holds
+*         for lpPix[i]
+***********************************************************************************/
+template<typename OP>
+static vec16u mask_pack_word(const vec08u* lpPix, OP lOp)
+{
+   vec16u lZero = 0;
+   vec16u lBits = 0;
+   apex_unroll_loop_full
+   for (int i = 0; i < BINARY_MASK_WORD_BITS; ++i)
+   {
+      vec16u lBit = (vec16u)(1 << i);
+      lBits = lBits | vselect(lBit, lZero, lOp(__builtin_convertvector(lpPix[i], vec16u)));
+   }
+   return lBits;
+}
+
+/*!*********************************************************************************
+*  \brief Packs a tile, one mask word per 16 pixels of each line
+***********************************************************************************/
+template<typename OP>
+static void mask_pack_tile(vec16u* dst, int dstr,
+                           const vec08u* src, int sstr,
+                           int bw, int bh, OP lOp)
+{
+   int lWords = bw / BINARY_MASK_WORD_BITS;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = mask_pack_word(src + x * BINARY_MASK_WORD_BITS, lOp);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+/* Pixel predicates of the packing loop */
+struct mask_greater
+{
+   vec16u mThreshold;
+   vbool operator()(vec16u v) const { return vsgt(v, mThreshold); }
+};
+
+struct mask_in_range
+{
+   vec16u mLower;
+   vec16u mUpper;
+   // pixels below mLower are replaced by mUpper + 1 so one compare decides
+   vbool operator()(vec16u v) const { return vsge(mUpper, vselect(v, mUpper + (vec16u)1, vsge(v, mLower))); }
+};
+
+struct mask_nonzero
+{
+   vbool operator()(vec16u v) const { return vsne(v, (vec16u)0); }
+};
+
+void apu_threshold_packed(vec16u* dst, int dstr,
+                          const vec08u* src, int sstr,
+                          int bw, int bh,
+                          uint8_t lThreshold)
+{
+   mask_greater lOp;
+   lOp.mThreshold = lThreshold;
+   mask_pack_tile(dst, dstr, src, sstr, bw, bh, lOp);
+}
+
+void apu_threshold_range_packed(vec16u* dst, int dstr,
+                                const vec08u* src, int sstr,
+                                int bw, int bh,
+                                uint8_t lLower, uint8_t lUpper)
+{
+   mask_in_range lOp;
+   lOp.mLower = lLower;
+   lOp.mUpper = lUpper;
+   mask_pack_tile(dst, dstr, src, sstr, bw, bh, lOp);
+}
+
+void apu_mask_pack(vec16u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh)
+{
+   mask_pack_tile(dst, dstr, src, sstr, bw, bh, mask_nonzero());
+}
+
+void apu_mask_unpack(vec08u* dst, int dstr,
+                     const vec16u* src, int sstr,
+                     int bw, int bh,
+                     uint8_t lTrueVal, uint8_t lFalseVal)
+{
+   int    lWords = bw / BINARY_MASK_WORD_BITS;
+   vec16u lTrue  = lTrueVal;
+   vec16u lFalse = lFalseVal;
+   vec16u lZero  = 0;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u  lBits = src[x];
+         vec08u* lpPix = dst + x * BINARY_MASK_WORD_BITS;
+         apex_unroll_loop_full
+         for (int i = 0; i < BINARY_MASK_WORD_BITS; ++i)
+         {
+            vbool lSet = vsne(lBits & (vec16u)(1 << i), lZero);
+            lpPix[i] = __builtin_convertvector(vselect(lTrue, lFalse, lSet), vec08u);
+         }
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_mask_and(vec16u* dst, int dstr, const vec16u* srcA, int sstrA, const vec16u* srcB, int sstrB, int bw, int bh)
+{
+   int lWords = bw / BINARY_MASK_WORD_BITS;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = srcA[x] & srcB[x];
+      }
+      srcA += sstrA;
+      srcB += sstrB;
+      dst  += dstr;
+   }
+}
+
+void apu_mask_or(vec16u* dst, int dstr, const vec16u* srcA, int sstrA, const vec16u* srcB, int sstrB, int bw, int bh)
+{
+   int lWords = bw / BINARY_MASK_WORD_BITS;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = srcA[x] | srcB[x];
+      }
+      srcA += sstrA;
+      srcB += sstrB;
+      dst  += dstr;
+   }
+}
+
+void apu_mask_xor(vec16u* dst, int dstr, const vec16u* srcA, int sstrA, const vec16u* srcB, int sstrB, int bw, int bh)
+{
+   int lWords = bw / BINARY_MASK_WORD_BITS;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = srcA[x] ^ srcB[x];
+      }
+      srcA += sstrA;
+      srcB += sstrB;
+      dst  += dstr;
+   }
+}
+
+void apu_mask_not(vec16u* dst, int dstr, const vec16u* src, int sstr, int bw, int bh)
+{
+   int lWords = bw / BINARY_MASK_WORD_BITS;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = ~src[x];
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_mask_count(vec32u* lpvCount,
+                    const vec16u* src, int sstr,
+                    int bw, int bh)
+{
+   int    lWords = bw / BINARY_MASK_WORD_BITS;
+   vec32u lCount = *lpvCount;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      vec16u lRow = 0; // at most 16 * lWords, well inside 16 bit
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         lRow = lRow + vpcnt(src[x]);
+      }
+      vacl(lCount, lRow);
+      src += sstr;
+   }
+   *lpvCount = lCount;
+}
+
+void apu_mask_count_ragged(vec32u* lpvCount,
+                           const vec16u* src, int sstr,
+                           int bw, int bh,
+                           vec16s lvValid)
+{
+   int    lWords = bw / BINARY_MASK_WORD_BITS;
+   vec32u lCount = *lpvCount;
+   vec16u lAll   = 0xFFFF;
+   vec16s lBits  = BINARY_MASK_WORD_BITS;
+   vec16s lZero  = 0;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      vec16s lLeft = lvValid;
+      vec16u lRow  = 0;
+      for (int x = 0; x < lWords; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         // valid bits of this word: clamp(lLeft, 0, 16), as a low bit mask
+         vec16s lN    = vselect(lZero, vselect(lBits, lLeft, vsgt(lLeft, lBits)), vsgt(lZero, lLeft));
+         vec16u lMask = vselect(lAll, vsll((vec16u)1, (vec16u)lN) - (vec16u)1, vsge(lN, lBits));
+         lRow  = lRow + vpcnt(src[x] & lMask);
+         lLeft = lLeft - lBits;
+      }
+      vacl(lCount, lRow);
+      src += sstr;
+   }
+   *lpvCount = lCount;
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
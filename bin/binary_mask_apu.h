@@ -0,0 +1,91 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file binary_mask_apu.h
+*  @brief APU implementation of the bit-packed binary mask kernels
+*
+*  bw is always the width of the 8 bit tile in pixels and must be a multiple
+*  of 16; the packed tiles are bw / 16 words wide.
+***********************************************************************************/
+
+#ifndef APUBINARYMASKIMPL_H
+#define APUBINARYMASKIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Binary threshold into a packed mask: bit set where src > lThreshold
+***********************************************************************************/
+void apu_threshold_packed(vec16u* dst, int dstr,
+                          const vec08u* src, int sstr,
+                          int bw, int bh,
+                          uint8_t lThreshold);
+
+/*!*********************************************************************************
+*  \brief Range threshold into a packed mask: bit set where lLower <= src <= lUpper
+***********************************************************************************/
+void apu_threshold_range_packed(vec16u* dst, int dstr,
+                                const vec08u* src, int sstr,
+                                int bw, int bh,
+                                uint8_t lLower, uint8_t lUpper);
+
+/*!*********************************************************************************
+*  \brief Packs a byte mask: bit set where src is not zero
+***********************************************************************************/
+void apu_mask_pack(vec16u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Unpacks a mask to bytes of lTrueVal (bit set) and lFalseVal (bit clear)
+***********************************************************************************/
+void apu_mask_unpack(vec08u* dst, int dstr,
+                     const vec16u* src, int sstr,
+                     int bw, int bh,
+                     uint8_t lTrueVal, uint8_t lFalseVal);
+
+void apu_mask_and(vec16u* dst, int dstr, const vec16u* srcA, int sstrA, const vec16u* srcB, int sstrB, int bw, int bh);
+void apu_mask_or(vec16u* dst, int dstr, const vec16u* srcA, int sstrA, const vec16u* srcB, int sstrB, int bw, int bh);
+void apu_mask_xor(vec16u* dst, int dstr, const vec16u* srcA, int sstrA, const vec16u* srcB, int sstrB, int bw, int bh);
+void apu_mask_not(vec16u* dst, int dstr, const vec16u* src, int sstr, int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Adds the number of set pixels of a packed tile to the per-CU count lpvCount
+***********************************************************************************/
+void apu_mask_count(vec32u* lpvCount,
+                    const vec16u* src, int sstr,
+                    int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief apu_mask_count() for a ragged tile: bits beyond the frame width are ignored
+*
+*  \param lvValid  valid pixels per CU, see apu_ragged_valid_columns() (called
+*                  with the 8 bit pixel chunk width)
+***********************************************************************************/
+void apu_mask_count_ragged(vec32u* lpvCount,
+                           const vec16u* src, int sstr,
+                           int bw, int bh,
+                           vec16s lvValid);
+
+#endif /* APUBINARYMASKIMPL_H */
@@ -0,0 +1,177 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file block_norm_acf.cpp
+* \addtogroup apexcv-block_norm
+* \addtogroup block_norm
+* \ingroup block_norm
+* @{
+* \brief block floating point normalisation
+*/
+
+/*!*********************************************************************************
+*  @file block_norm_acf.cpp
+*  @brief ACF metadata and wrapper functions for the block floating point normalisation kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "block_norm_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the block normalisation kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(BLOCK_NORM_16s_K)
+(
+   BLOCK_NORM_16s_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_1),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(BLOCK_NORM_MAX_TILES + 1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the block normalisation kernel (unsigned 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(BLOCK_NORM_16u_K)
+(
+   BLOCK_NORM_16u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_1),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(BLOCK_NORM_MAX_TILES + 1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "block_norm_acf.h"
+#include "block_norm_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Appends the exponent of the current tile to the exponent port
+***********************************************************************************/
+static void block_norm_record(int16_t* lpExp, int lShift)
+{
+   int lTile = lpExp[0];
+   if (lTile < BLOCK_NORM_MAX_TILES)
+   {
+      lpExp[1 + lTile] = (int16_t)lShift;
+      lpExp[0]         = (int16_t)(lTile + 1);
+   }
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the block normalisation kernel (signed 16 bit)
+*
+*  Every tile is shifted left by its own exponent. OUTPUT_1[0] counts the tiles
+*  of the frame and OUTPUT_1[1 + i] holds the exponent of tile i; tiles beyond
+*  BLOCK_NORM_MAX_TILES are still normalised but their exponent is not kept.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void block_normalize_16s(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lOut1)
+{
+   vec16s*  lpvIn0  = (vec16s*)lIn0.pMem;
+   vec16s*  lpvOut0 = (vec16s*)lOut0.pMem;
+   int16_t* lpExp   = (int16_t*)lOut1.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      lpExp[0] = 0;
+   }
+   int lShift = apu_block_normalize( lpvOut0, lOut0.chunkSpan / 2,
+                                     lpvIn0, lIn0.chunkSpan / 2,
+                                     lIn0.chunkWidth, lIn0.chunkHeight );
+   block_norm_record(lpExp, lShift);
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the block normalisation kernel (unsigned 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void block_normalize_16u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lOut1)
+{
+   vec16u*  lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u*  lpvOut0 = (vec16u*)lOut0.pMem;
+   int16_t* lpExp   = (int16_t*)lOut1.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      lpExp[0] = 0;
+   }
+   int lShift = apu_block_normalize( lpvOut0, lOut0.chunkSpan / 2,
+                                     lpvIn0, lIn0.chunkSpan / 2,
+                                     lIn0.chunkWidth, lIn0.chunkHeight );
+   block_norm_record(lpExp, lShift);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
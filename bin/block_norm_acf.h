@@ -0,0 +1,45 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file block_norm_acf.h
+*  @brief Kernel identifiers for the block floating point normalisation kernels
+***********************************************************************************/
+
+#ifndef BLOCKNORMACF_H
+#define BLOCKNORMACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define OUTPUT_0                        "OUTPUT_0"
+#define OUTPUT_1                        "OUTPUT_1"
+
+/*! Tiles per frame the exponent port can record */
+#define BLOCK_NORM_MAX_TILES            256
+
+#define BLOCK_NORM_16s_K                block_normalize_16s
+#define BLOCK_NORM_16s_KN               "block_normalize_16s"
+
+#define BLOCK_NORM_16u_K                block_normalize_16u
+#define BLOCK_NORM_16u_KN               "block_normalize_16u"
+
+#endif /* BLOCKNORMACF_H */
@@ -0,0 +1,121 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file block_norm_apu.cpp
+*  @brief APU implementation of the block floating point normalisation kernels
+*
+*  The tile is read twice: once to find the headroom of every CU chunk
+*  (vclb - 1 redundant sign bits for signed data, vclz for unsigned data),
+*  then, after the minimum has been reduced across the CUs, to apply the
+*  common shift.
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "block_norm_apu.h"
+
+/*! Largest shift applied; an all zero block is left unchanged by it anyway */
+#define BLOCK_NORM_MAX_SHIFT 15
+
+/*!*********************************************************************************
+*  \brief Minimum of the per-CU headroom over the active CUs
+***********************************************************************************/
+static int block_norm_cu_min(vec16s lvHead)
+{
+   int lCUs = apuGetNumberOfCUs();
+   int lMin = BLOCK_NORM_MAX_SHIFT;
+
+   for (int i = 0; i < lCUs; ++i) chess_loop_range(1,)
+   {
+      int lHead = vget(lvHead, i);
+      lMin = (lHead < lMin) ? lHead : lMin;
+   }
+   return lMin;
+}
+
+int apu_block_normalize(vec16s* dst, int dstr,
+                        const vec16s* src, int sstr,
+                        int bw, int bh)
+{
+   vec16s        lvHead = BLOCK_NORM_MAX_SHIFT;
+   const vec16s* lpSrc  = src;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16s lHead = vclb(lpSrc[x]) - (vec16s)1;
+         lvHead = vselect(lHead, lvHead, vsgt(lvHead, lHead));
+      }
+      lpSrc += sstr;
+   }
+
+   int    lShift  = block_norm_cu_min(lvHead);
+   vec16s lvShift = lShift;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = vsll(src[x], lvShift);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+   return lShift;
+}
+
+int apu_block_normalize(vec16u* dst, int dstr,
+                        const vec16u* src, int sstr,
+                        int bw, int bh)
+{
+   vec16u        lvHead = BLOCK_NORM_MAX_SHIFT;
+   const vec16u* lpSrc  = src;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lHead = vclz(lpSrc[x]);
+         lvHead = vselect(lHead, lvHead, vsgt(lvHead, lHead));
+      }
+      lpSrc += sstr;
+   }
+
+   int    lShift  = block_norm_cu_min((vec16s)lvHead);
+   vec16u lvShift = lShift;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = vsll(src[x], lvShift);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+   return lShift;
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
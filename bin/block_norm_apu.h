@@ -0,0 +1,60 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file block_norm_apu.h
+*  @brief APU implementation of the block floating point normalisation kernels
+*
+*  A block is one tile, i.e. the chunks of all CUs processed together. All
+*  values of a block are shifted left by the same exponent, the largest one
+*  that does not overflow any of them, so the block keeps its relative scale.
+***********************************************************************************/
+
+#ifndef APUBLOCKNORMIMPL_H
+#define APUBLOCKNORMIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Normalises a signed 16 bit tile
+*
+*  \param dst  output tile
+*  \param dstr output stride in vec16s elements
+*  \param src  input tile
+*  \param sstr input stride in vec16s elements
+*  \param bw   chunk width
+*  \param bh   chunk height
+*  \return     left shift applied to the block (0 .. 15)
+***********************************************************************************/
+int apu_block_normalize(vec16s* dst, int dstr,
+                        const vec16s* src, int sstr,
+                        int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Normalises an unsigned 16 bit tile, see the signed variant
+***********************************************************************************/
+int apu_block_normalize(vec16u* dst, int dstr,
+                        const vec16u* src, int sstr,
+                        int bw, int bh);
+
+#endif /* APUBLOCKNORMIMPL_H */
@@ -0,0 +1,236 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file census_acf.cpp
+* \addtogroup apexcv-census
+* \addtogroup census
+* \ingroup census
+* @{
+* \brief census transform and Hamming matching cost
+*/
+
+/*!*********************************************************************************
+*  @file census_acf.cpp
+*  @brief ACF metadata and wrapper functions for the census transform and Hamming cost kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "census_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 5x5 census transform kernel (unsigned 8 bit in, signature out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CENSUS_5x5_08u_K)
+(
+   CENSUS_5x5_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(CENSUS_WORDS_5x5, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 7x7 census transform kernel (unsigned 8 bit in, signature out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CENSUS_7x7_08u_K)
+(
+   CENSUS_7x7_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(3,3,3,3),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(CENSUS_WORDS_7x7, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the Hamming cost kernel (5x5 census signatures in, cost volume out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(HAMMING_COST_5x5_K)
+(
+   HAMMING_COST_5x5_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(CENSUS_WORDS_5x5, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(CENSUS_DISPARITIES-1,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(CENSUS_WORDS_5x5, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(CENSUS_DISPARITIES, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the Hamming cost kernel (7x7 census signatures in, cost volume out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(HAMMING_COST_7x7_K)
+(
+   HAMMING_COST_7x7_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(CENSUS_WORDS_7x7, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(CENSUS_DISPARITIES-1,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(CENSUS_WORDS_7x7, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(CENSUS_DISPARITIES, 1),
+          __ek_size(1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "census_acf.h"
+#include "census_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 5x5 census transform kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void census_5x5_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_census_5x5( lpvOut0, lOut0.chunkSpan / 2,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 7x7 census transform kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void census_7x7_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_census_7x7( lpvOut0, lOut0.chunkSpan / 2,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the Hamming cost kernel (5x5 census)
+*
+*  INPUT_0 holds the left and INPUT_1 the right signatures; OUTPUT_0 holds
+*  CENSUS_DISPARITIES costs per pixel, ordered by disparity.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void hamming_cost_5x5(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvIn1  = (vec16u*)lIn1.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_hamming_cost_5x5( lpvOut0, lOut0.chunkSpan,
+                         lpvIn0, lIn0.chunkSpan / 2,
+                         lpvIn1, lIn1.chunkSpan / 2,
+                         lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the Hamming cost kernel (7x7 census)
+*
+*  INPUT_0 holds the left and INPUT_1 the right signatures; OUTPUT_0 holds
+*  CENSUS_DISPARITIES costs per pixel, ordered by disparity.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void hamming_cost_7x7(kernel_io_desc lIn0, kernel_io_desc lIn1, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvIn1  = (vec16u*)lIn1.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_hamming_cost_7x7( lpvOut0, lOut0.chunkSpan,
+                         lpvIn0, lIn0.chunkSpan / 2,
+                         lpvIn1, lIn1.chunkSpan / 2,
+                         lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
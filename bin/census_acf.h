@@ -0,0 +1,60 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file census_acf.h
+*  @brief Kernel identifiers for the census transform and Hamming cost kernels
+*
+*  A census signature has one bit per window neighbour (row major, centre
+*  skipped), set where the neighbour is darker than the centre. It is stored
+*  as CENSUS_WORDS_NxN 16 bit words per pixel, i.e. an e0 width of that many
+*  d16u elements.
+***********************************************************************************/
+
+#ifndef CENSUSACF_H
+#define CENSUSACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define INPUT_1                         "INPUT_1"
+#define OUTPUT_0                        "OUTPUT_0"
+
+/*! Signature words per pixel (24 and 48 bits) */
+#define CENSUS_WORDS_5x5                2
+#define CENSUS_WORDS_7x7                3
+
+/*! Disparities 0 .. CENSUS_DISPARITIES - 1 evaluated by the cost kernels */
+#define CENSUS_DISPARITIES              16
+
+#define CENSUS_5x5_08u_K                census_5x5_08u
+#define CENSUS_5x5_08u_KN               "census_5x5_08u"
+
+#define CENSUS_7x7_08u_K                census_7x7_08u
+#define CENSUS_7x7_08u_KN               "census_7x7_08u"
+
+#define HAMMING_COST_5x5_K              hamming_cost_5x5
+#define HAMMING_COST_5x5_KN             "hamming_cost_5x5"
+
+#define HAMMING_COST_7x7_K              hamming_cost_7x7
+#define HAMMING_COST_7x7_KN             "hamming_cost_7x7"
+
+#endif /* CENSUSACF_H */
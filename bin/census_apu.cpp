@@ -0,0 +1,158 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file census_apu.cpp
+*  @brief APU implementation of the census transform and Hamming cost kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "census_apu.h"
+#include "census_acf.h"
+
+/*!*********************************************************************************
+*  \brief Census transform of a (2R+1)x(2R+1) window into W signature words
+***********************************************************************************/
+template<int R, int W>
+static void census_tile(vec16u* dst, int dstr,
+                        const vec08u* src, int sstr,
+                        int bw, int bh)
+{
+   vec16u lZero = 0;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lCentre = __builtin_convertvector(src[x], vec16u);
+         vec16u lWords[W];
+         apex_unroll_loop_full
+         for (int w = 0; w < W; ++w)
+         {
+            lWords[w] = 0;
+         }
+
+         int lBit = 0;
+         apex_unroll_loop_full
+         for (int dy = -R; dy <= R; ++dy)
+         {
+            apex_unroll_loop_full
+            for (int dx = -R; dx <= R; ++dx)
+            {
+               if (dy == 0 && dx == 0)
+               {
+                  continue;
+               }
+               vec16u lNeighbour = __builtin_convertvector(src[dy * sstr + x + dx], vec16u);
+               vec16u lMask      = (vec16u)(1 << (lBit & 15));
+               lWords[lBit >> 4] = lWords[lBit >> 4] | vselect(lMask, lZero, vsgt(lCentre, lNeighbour));
+               ++lBit;
+            }
+         }
+
+         apex_unroll_loop_full
+         for (int w = 0; w < W; ++w)
+         {
+            dst[x * W + w] = lWords[w];
+         }
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+/*!*********************************************************************************
+*  \brief Hamming cost volume of W word signatures over CENSUS_DISPARITIES
+*
+*  The cost of a 48 bit signature is at most 48, so the per word popcounts are
+*  summed in 16 bit and stored as bytes.
+***********************************************************************************/
+template<int W>
+static void hamming_cost_tile(vec08u* dst, int dstr,
+                              const vec16u* srcL, int sstrL,
+                              const vec16u* srcR, int sstrR,
+                              int bw, int bh)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         const vec16u* lpL = srcL + x * W;
+         vec16u lLeft[W];
+         apex_unroll_loop_full
+         for (int w = 0; w < W; ++w)
+         {
+            lLeft[w] = lpL[w];
+         }
+
+         apex_unroll_loop_full
+         for (int d = 0; d < CENSUS_DISPARITIES; ++d)
+         {
+            const vec16u* lpR   = srcR + (x - d) * W;
+            vec16u        lCost = 0;
+            apex_unroll_loop_full
+            for (int w = 0; w < W; ++w)
+            {
+               lCost = lCost + vpcnt(lLeft[w] ^ lpR[w]);
+            }
+            dst[x * CENSUS_DISPARITIES + d] = __builtin_convertvector(lCost, vec08u);
+         }
+      }
+      srcL += sstrL;
+      srcR += sstrR;
+      dst  += dstr;
+   }
+}
+
+void apu_census_5x5(vec16u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh)
+{
+   census_tile<2, CENSUS_WORDS_5x5>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_census_7x7(vec16u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh)
+{
+   census_tile<3, CENSUS_WORDS_7x7>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_hamming_cost_5x5(vec08u* dst, int dstr,
+                          const vec16u* srcL, int sstrL,
+                          const vec16u* srcR, int sstrR,
+                          int bw, int bh)
+{
+   hamming_cost_tile<CENSUS_WORDS_5x5>(dst, dstr, srcL, sstrL, srcR, sstrR, bw, bh);
+}
+
+void apu_hamming_cost_7x7(vec08u* dst, int dstr,
+                          const vec16u* srcL, int sstrL,
+                          const vec16u* srcR, int sstrR,
+                          int bw, int bh)
+{
+   hamming_cost_tile<CENSUS_WORDS_7x7>(dst, dstr, srcL, sstrL, srcR, sstrR, bw, bh);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
@@ -0,0 +1,85 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file census_apu.h
+*  @brief APU implementation of the census transform and Hamming cost kernels
+***********************************************************************************/
+
+#ifndef APUCENSUSIMPL_H
+#define APUCENSUSIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief 5x5 census transform (24 bit signature in 2 words per pixel)
+*
+*  \param dst  output signatures
+*  \param dstr output stride in vec16u elements
+*  \param src  input tile, with 2 pixels of border on every side
+*  \param sstr input stride in vec08u elements
+*  \param bw   chunk width in pixels
+*  \param bh   chunk height
+***********************************************************************************/
+void apu_census_5x5(vec16u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief 7x7 census transform (48 bit signature in 3 words per pixel)
+*
+*  Same parameters as apu_census_5x5(), with 3 pixels of border.
+***********************************************************************************/
+void apu_census_7x7(vec16u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Hamming cost volume of 5x5 census signatures
+*
+*  dst receives CENSUS_DISPARITIES costs per pixel; cost d of pixel x is the
+*  Hamming distance between srcL[x] and srcR[x - d].
+*
+*  \param dst   output costs (CENSUS_DISPARITIES bytes per pixel)
+*  \param dstr  output stride in vec08u elements
+*  \param srcL  left signatures
+*  \param sstrL left stride in vec16u elements
+*  \param srcR  right signatures, with CENSUS_DISPARITIES - 1 pixels of left border
+*  \param sstrR right stride in vec16u elements
+*  \param bw    chunk width in pixels
+*  \param bh    chunk height
+***********************************************************************************/
+void apu_hamming_cost_5x5(vec08u* dst, int dstr,
+                          const vec16u* srcL, int sstrL,
+                          const vec16u* srcR, int sstrR,
+                          int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Hamming cost volume of 7x7 census signatures, see apu_hamming_cost_5x5()
+***********************************************************************************/
+void apu_hamming_cost_7x7(vec08u* dst, int dstr,
+                          const vec16u* srcL, int sstrL,
+                          const vec16u* srcR, int sstrR,
+                          int bw, int bh);
+
+#endif /* APUCENSUSIMPL_H */
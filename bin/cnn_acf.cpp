@@ -0,0 +1,310 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file cnn_acf.cpp
+* \addtogroup apexcv-cnn
+* \addtogroup cnn
+* \ingroup cnn
+* @{
+* \brief quantised int8 convolution for small CNN inference
+*/
+
+/*!*********************************************************************************
+*  @file cnn_acf.cpp
+*  @brief ACF metadata and wrapper functions for the quantised int8 convolution kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "cnn_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the int8 3x3 convolution kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CNN_CONV_3x3_08s_K)
+(
+   CNN_CONV_3x3_08s_KN,
+   6,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08s),
+          __e0_size(CNN_CIN, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(1, 1),
+          __ek_size(CNN_COUT * 9 * CNN_CIN, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32s),
+          __e0_size(1, 1),
+          __ek_size(CNN_COUT, 1)),
+   __port(__index(3),
+          __identifier(INPUT_3),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(2 * CNN_COUT, 1)),
+   __port(__index(4),
+          __identifier(INPUT_4),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(5),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(CNN_COUT, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the int8 1x1 convolution kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CNN_CONV_1x1_08s_K)
+(
+   CNN_CONV_1x1_08s_KN,
+   6,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(CNN_CIN, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(1, 1),
+          __ek_size(CNN_COUT * CNN_CIN, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32s),
+          __e0_size(1, 1),
+          __ek_size(CNN_COUT, 1)),
+   __port(__index(3),
+          __identifier(INPUT_3),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(2 * CNN_COUT, 1)),
+   __port(__index(4),
+          __identifier(INPUT_4),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(5),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(CNN_COUT, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the int8 depthwise 3x3 convolution kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CNN_CONV_DW_3x3_08s_K)
+(
+   CNN_CONV_DW_3x3_08s_KN,
+   6,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08s),
+          __e0_size(CNN_CIN, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(1, 1),
+          __ek_size(CNN_CIN * 9, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32s),
+          __e0_size(1, 1),
+          __ek_size(CNN_CIN, 1)),
+   __port(__index(3),
+          __identifier(INPUT_3),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(2 * CNN_CIN, 1)),
+   __port(__index(4),
+          __identifier(INPUT_4),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(5),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(CNN_CIN, 1),
+          __ek_size(1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "cnn_acf.h"
+#include "cnn_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Copies the per channel shifts, clamped to the 0..15 cnn_requant supports
+***********************************************************************************/
+static void cnn_clamp_shifts(int16_t* lpDst, const int16_t* lpSrc, int lCount)
+{
+   for (int i = 0; i < lCount; ++i)
+   {
+      int16_t lShift = lpSrc[i];
+      lpDst[i] = (lShift < 0) ? 0 : ((lShift > 15) ? 15 : lShift);
+   }
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the int8 3x3 convolution kernel
+*
+*  INPUT_1 holds the weights, INPUT_2 the per channel biases, INPUT_3 the
+*  per channel Q15 multipliers followed by the per channel shifts (clamped to
+*  0..15), and INPUT_4[0] enables the fused ReLU. See cnn_apu.h for the
+*  requantisation.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void cnn_conv_3x3_08s(kernel_io_desc lIn0, kernel_io_desc lWeights, kernel_io_desc lBias, kernel_io_desc lScale, kernel_io_desc lRelu, kernel_io_desc lOut0)
+{
+   vec08s*  lpvIn0   = (vec08s*)lIn0.pMem;
+   int8_t*  lpW      = (int8_t*)lWeights.pMem;
+   int16_t* lpScale  = (int16_t*)lScale.pMem;
+   vec08s*  lpvOut0  = (vec08s*)lOut0.pMem;
+
+   int16_t  lShift[CNN_COUT];
+   cnn_clamp_shifts(lShift, lpScale + CNN_COUT, CNN_COUT);
+
+   CNN_REQUANT lRequant;
+   lRequant.mpBias  = (int32_t*)lBias.pMem;
+   lRequant.mpMult  = lpScale;
+   lRequant.mpShift = lShift;
+   lRequant.mRelu   = ((uint8_t*)lRelu.pMem)[0] != 0;
+
+   apu_cnn_conv_3x3( lpvOut0, lOut0.chunkSpan,
+                     lpvIn0, lIn0.chunkSpan,
+                     lIn0.chunkWidth, lIn0.chunkHeight,
+                     lpW, lRequant );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the int8 1x1 convolution kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void cnn_conv_1x1_08s(kernel_io_desc lIn0, kernel_io_desc lWeights, kernel_io_desc lBias, kernel_io_desc lScale, kernel_io_desc lRelu, kernel_io_desc lOut0)
+{
+   vec08s*  lpvIn0   = (vec08s*)lIn0.pMem;
+   int8_t*  lpW      = (int8_t*)lWeights.pMem;
+   int16_t* lpScale  = (int16_t*)lScale.pMem;
+   vec08s*  lpvOut0  = (vec08s*)lOut0.pMem;
+
+   int16_t  lShift[CNN_COUT];
+   cnn_clamp_shifts(lShift, lpScale + CNN_COUT, CNN_COUT);
+
+   CNN_REQUANT lRequant;
+   lRequant.mpBias  = (int32_t*)lBias.pMem;
+   lRequant.mpMult  = lpScale;
+   lRequant.mpShift = lShift;
+   lRequant.mRelu   = ((uint8_t*)lRelu.pMem)[0] != 0;
+
+   apu_cnn_conv_1x1( lpvOut0, lOut0.chunkSpan,
+                     lpvIn0, lIn0.chunkSpan,
+                     lIn0.chunkWidth, lIn0.chunkHeight,
+                     lpW, lRequant );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the int8 depthwise 3x3 convolution kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void cnn_conv_dw_3x3_08s(kernel_io_desc lIn0, kernel_io_desc lWeights, kernel_io_desc lBias, kernel_io_desc lScale, kernel_io_desc lRelu, kernel_io_desc lOut0)
+{
+   vec08s*  lpvIn0   = (vec08s*)lIn0.pMem;
+   int8_t*  lpW      = (int8_t*)lWeights.pMem;
+   int16_t* lpScale  = (int16_t*)lScale.pMem;
+   vec08s*  lpvOut0  = (vec08s*)lOut0.pMem;
+
+   int16_t  lShift[CNN_CIN];
+   cnn_clamp_shifts(lShift, lpScale + CNN_CIN, CNN_CIN);
+
+   CNN_REQUANT lRequant;
+   lRequant.mpBias  = (int32_t*)lBias.pMem;
+   lRequant.mpMult  = lpScale;
+   lRequant.mpShift = lShift;
+   lRequant.mRelu   = ((uint8_t*)lRelu.pMem)[0] != 0;
+
+   apu_cnn_conv_dw_3x3( lpvOut0, lOut0.chunkSpan,
+                        lpvIn0, lIn0.chunkSpan,
+                        lIn0.chunkWidth, lIn0.chunkHeight,
+                        lpW, lRequant );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
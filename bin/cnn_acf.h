@@ -0,0 +1,55 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file cnn_acf.h
+*  @brief Kernel identifiers for the quantised int8 convolution kernels
+*
+*  Feature maps are interleaved: pixel x of a map with C channels holds
+*  channel c at element x * C + c (an e0 width of C).
+***********************************************************************************/
+
+#ifndef CNNACF_H
+#define CNNACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define INPUT_1                         "INPUT_1"
+#define INPUT_2                         "INPUT_2"
+#define INPUT_3                         "INPUT_3"
+#define INPUT_4                         "INPUT_4"
+#define OUTPUT_0                        "OUTPUT_0"
+
+/*! Channels of the input and output feature maps */
+#define CNN_CIN                         8
+#define CNN_COUT                        8
+
+#define CNN_CONV_3x3_08s_K              cnn_conv_3x3_08s
+#define CNN_CONV_3x3_08s_KN             "cnn_conv_3x3_08s"
+
+#define CNN_CONV_1x1_08s_K              cnn_conv_1x1_08s
+#define CNN_CONV_1x1_08s_KN             "cnn_conv_1x1_08s"
+
+#define CNN_CONV_DW_3x3_08s_K           cnn_conv_dw_3x3_08s
+#define CNN_CONV_DW_3x3_08s_KN          "cnn_conv_dw_3x3_08s"
+
+#endif /* CNNACF_H */
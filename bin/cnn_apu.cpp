@@ -0,0 +1,166 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file cnn_apu.cpp
+*  @brief APU implementation of the quantised int8 convolution kernels
+*
+*  Each int8 x int8 product is formed by one 8x8 multiply (vmul_slsl) and
+*  widened into the split 32 bit accumulator with vacl, instead of a full
+*  16x16 vmac.
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "cnn_apu.h"
+#include "cnn_acf.h"
+
+/*!*********************************************************************************
+*  \brief acc += x * w for int8 x and w
+***********************************************************************************/
+static inline void cnn_mac(vacc32s* lpAcc, vec08s x, int8_t w)
+{
+   vacc_acl(lpAcc, vmul_slsl(__builtin_convertvector(x, vec16s), (vec16s)w));
+}
+
+/*!*********************************************************************************
+*  \brief Requantises the sum of output channel co, see cnn_apu.h
+***********************************************************************************/
+static inline vec08s cnn_requant(vacc32s lAcc, const CNN_REQUANT& lRequant, int co)
+{
+   int lShift = lRequant.mpShift[co];
+   if (lShift > 0)
+   {
+      vacc_acl(&lAcc, (vec16s)(1 << (lShift - 1)));
+   }
+   vec16s  lT = vacc_narrow(lAcc, lShift);
+
+   vacc32s lScaled;
+   vacc_clear(&lScaled);
+   vacc_acl(&lScaled, (vec16s)(1 << 14));
+   vacc_mac(&lScaled, lT, (vec16s)lRequant.mpMult[co]);
+   vec16s  lOut = vacc_narrow(lScaled, 15);
+
+   vec16s lMax = 127;
+   vec16s lMin = lRequant.mRelu ? 0 : -128;
+   lOut = vselect(lMax, lOut, vsgt(lOut, lMax));
+   lOut = vselect(lMin, lOut, vsgt(lMin, lOut));
+   return __builtin_convertvector(lOut, vec08s);
+}
+
+/*!*********************************************************************************
+*  \brief Accumulator of output channel co, initialised with its bias
+***********************************************************************************/
+static inline vacc32s cnn_bias(const CNN_REQUANT& lRequant, int co)
+{
+   vacc32s lAcc;
+   vacc_set(&lAcc, (vec32s)lRequant.mpBias[co]);
+   return lAcc;
+}
+
+void apu_cnn_conv_3x3(vec08s* dst, int dstr,
+                      const vec08s* src, int sstr,
+                      int bw, int bh,
+                      const int8_t* lpW, const CNN_REQUANT& lRequant)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int co = 0; co < CNN_COUT; ++co) chess_loop_range(1,)
+      {
+         const int8_t* lpWco = lpW + co * 9 * CNN_CIN;
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            vacc32s lAcc = cnn_bias(lRequant, co);
+            for (int ky = 0; ky < 3; ++ky) chess_loop_range(1,)
+            {
+               const vec08s* lpRow = src + (ky - 1) * sstr + (x - 1) * CNN_CIN;
+               for (int i = 0; i < 3 * CNN_CIN; ++i) chess_loop_range(1,)
+               {
+                  cnn_mac(&lAcc, lpRow[i], lpWco[ky * 3 * CNN_CIN + i]);
+               }
+            }
+            dst[x * CNN_COUT + co] = cnn_requant(lAcc, lRequant, co);
+         }
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_cnn_conv_1x1(vec08s* dst, int dstr,
+                      const vec08s* src, int sstr,
+                      int bw, int bh,
+                      const int8_t* lpW, const CNN_REQUANT& lRequant)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int co = 0; co < CNN_COUT; ++co) chess_loop_range(1,)
+      {
+         const int8_t* lpWco = lpW + co * CNN_CIN;
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            vacc32s lAcc = cnn_bias(lRequant, co);
+            apex_unroll_loop_full
+            for (int ci = 0; ci < CNN_CIN; ++ci)
+            {
+               cnn_mac(&lAcc, src[x * CNN_CIN + ci], lpWco[ci]);
+            }
+            dst[x * CNN_COUT + co] = cnn_requant(lAcc, lRequant, co);
+         }
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_cnn_conv_dw_3x3(vec08s* dst, int dstr,
+                         const vec08s* src, int sstr,
+                         int bw, int bh,
+                         const int8_t* lpW, const CNN_REQUANT& lRequant)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int c = 0; c < CNN_CIN; ++c) chess_loop_range(1,)
+      {
+         const int8_t* lpWc = lpW + c * 9;
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            vacc32s lAcc = cnn_bias(lRequant, c);
+            apex_unroll_loop_full
+            for (int ky = 0; ky < 3; ++ky)
+            {
+               apex_unroll_loop_full
+               for (int kx = 0; kx < 3; ++kx)
+               {
+                  cnn_mac(&lAcc, src[(ky - 1) * sstr + (x + kx - 1) * CNN_CIN + c], lpWc[ky * 3 + kx]);
+               }
+            }
+            dst[x * CNN_CIN + c] = cnn_requant(lAcc, lRequant, c);
+         }
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
@@ -0,0 +1,87 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file cnn_apu.h
+*  @brief APU implementation of the quantised int8 convolution kernels
+*
+*  Symmetric int8 quantisation. For output channel co the 32 bit sum
+*  acc = bias[co] + sum(w * x) is requantised as
+*
+*     t   = sat16((acc + 2^(shift - 1)) >> shift)      (no rounding for shift 0)
+*     out = sat8((t * mult + 2^14) >> 15)
+*
+*  with mult a Q15 multiplier and shift in 0 .. 15; with ReLU the lower bound
+*  is 0 instead of -128. Weights and requantisation parameters stay in DMEM.
+***********************************************************************************/
+
+#ifndef APUCNNIMPL_H
+#define APUCNNIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Per output channel requantisation parameters
+***********************************************************************************/
+typedef struct
+{
+   const int32_t* mpBias;   /*!< CNN_COUT biases, in accumulator units */
+   const int16_t* mpMult;   /*!< CNN_COUT Q15 multipliers */
+   const int16_t* mpShift;  /*!< CNN_COUT right shifts (0 .. 15) */
+   bool           mRelu;    /*!< clamp at 0 instead of -128 */
+} CNN_REQUANT;
+
+/*!*********************************************************************************
+*  \brief 3x3 convolution, CNN_CIN -> CNN_COUT channels
+*
+*  \param dst      output map (CNN_COUT channels)
+*  \param dstr     output stride in vec08s elements
+*  \param src      input map (CNN_CIN channels), one pixel of border
+*  \param sstr     input stride in vec08s elements
+*  \param bw       chunk width in pixels
+*  \param bh       chunk height
+*  \param lpW      weights [co][ky][kx][ci]
+*  \param lRequant requantisation parameters
+***********************************************************************************/
+void apu_cnn_conv_3x3(vec08s* dst, int dstr,
+                      const vec08s* src, int sstr,
+                      int bw, int bh,
+                      const int8_t* lpW, const CNN_REQUANT& lRequant);
+
+/*!*********************************************************************************
+*  \brief 1x1 (pointwise) convolution, weights [co][ci]
+***********************************************************************************/
+void apu_cnn_conv_1x1(vec08s* dst, int dstr,
+                      const vec08s* src, int sstr,
+                      int bw, int bh,
+                      const int8_t* lpW, const CNN_REQUANT& lRequant);
+
+/*!*********************************************************************************
+*  \brief Depthwise 3x3 convolution, CNN_CIN channels, weights [c][ky][kx]
+***********************************************************************************/
+void apu_cnn_conv_dw_3x3(vec08s* dst, int dstr,
+                         const vec08s* src, int sstr,
+                         int bw, int bh,
+                         const int8_t* lpW, const CNN_REQUANT& lRequant);
+
+#endif /* APUCNNIMPL_H */
@@ -0,0 +1,169 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file compact_acf.cpp
+* \addtogroup apexcv-compact
+* \addtogroup compact
+* \ingroup compact
+* @{
+* \brief stream compaction (sparse coordinate lists)
+*/
+
+/*!*********************************************************************************
+*  @file compact_acf.cpp
+*  @brief ACF metadata and wrapper functions for the stream compaction kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "compact_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the stream compaction kernel (8 bit mask or image)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(COMPACT_08u_K)
+(
+   COMPACT_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(LIST),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(COMPACT_MAX_POINTS * COMPACT_POINT_FIELDS, 1)),
+   __port(__index(2),
+          __identifier(COUNT),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(3, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the stream compaction kernel (packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(COMPACT_1u_K)
+(
+   COMPACT_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(LIST),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(COMPACT_MAX_POINTS * COMPACT_POINT_FIELDS, 1)),
+   __port(__index(2),
+          __identifier(COUNT),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(3, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "compact_acf.h"
+#include "compact_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the stream compaction kernel (8 bit mask or image)
+*
+*  LIST receives (x, y, value) of every non zero pixel of the frame in raster
+*  order, COMPACT_POINT_FIELDS uint16_t per point. COUNT[0] is the number of
+*  points stored, COUNT[1] the number found; COUNT[1] > COUNT[0] means the list
+*  overflowed and the later points were dropped. COUNT[2] is the frame row of
+*  the next tile. x assumes the CU chunks of a row are adjacent, CU 0 leftmost.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void compact_08u(kernel_io_desc lIn0, kernel_io_desc lList, kernel_io_desc lCount)
+{
+   vec08u*   lpvIn0  = (vec08u*)lIn0.pMem;
+   uint16_t* lpList  = (uint16_t*)lList.pMem;
+   uint32_t* lpCount = (uint32_t*)lCount.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      lpCount[0] = 0;
+      lpCount[1] = 0;
+      lpCount[2] = 0;
+   }
+   apu_compact( lpList, COMPACT_MAX_POINTS, lpCount,
+                lpvIn0, lIn0.chunkSpan,
+                lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the stream compaction kernel (packed mask)
+*  \see compact_08u
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void compact_1u(kernel_io_desc lIn0, kernel_io_desc lList, kernel_io_desc lCount)
+{
+   vec16u*   lpvIn0  = (vec16u*)lIn0.pMem;
+   uint16_t* lpList  = (uint16_t*)lList.pMem;
+   uint32_t* lpCount = (uint32_t*)lCount.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      lpCount[0] = 0;
+      lpCount[1] = 0;
+      lpCount[2] = 0;
+   }
+   apu_compact( lpList, COMPACT_MAX_POINTS, lpCount,
+                lpvIn0, lIn0.chunkSpan / 2,
+                lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
@@ -0,0 +1,48 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file compact_acf.h
+*  @brief Kernel identifiers for the stream compaction kernels
+***********************************************************************************/
+
+#ifndef COMPACTACF_H
+#define COMPACTACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define LIST                            "LIST"
+#define COUNT                           "COUNT"
+
+/*! Points the coordinate list can hold */
+#define COMPACT_MAX_POINTS              1024
+
+/*! uint16_t fields per point: x, y, value */
+#define COMPACT_POINT_FIELDS            3
+
+#define COMPACT_08u_K                   compact_08u
+#define COMPACT_08u_KN                  "compact_08u"
+
+#define COMPACT_1u_K                    compact_1u
+#define COMPACT_1u_KN                   "compact_1u"
+
+#endif /* COMPACTACF_H */
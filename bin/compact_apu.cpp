@@ -0,0 +1,156 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file compact_apu.cpp
+*  @brief APU implementation of the stream compaction kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "compact_apu.h"
+#include "compact_acf.h"
+
+/*!*********************************************************************************
+*  \brief Stores one point if there is room and counts it
+***********************************************************************************/
+static inline void compact_emit(uint16_t* lpList, int lCapacity, uint32_t* lpCount,
+                                int x, int y, int lValue)
+{
+   uint32_t lStored = lpCount[0];
+   if (lStored < (uint32_t)lCapacity)
+   {
+      uint16_t* lpPoint = lpList + lStored * COMPACT_POINT_FIELDS;
+      lpPoint[0] = (uint16_t)x;
+      lpPoint[1] = (uint16_t)y;
+      lpPoint[2] = (uint16_t)lValue;
+      lpCount[0] = lStored + 1;
+   }
+   lpCount[1] += 1;
+}
+
+/*!*********************************************************************************
+*  \brief Total of a per-CU count over the CU array
+***********************************************************************************/
+static inline uint32_t compact_total(vec16u lvCount, int lLast)
+{
+   return vget(vscan_incl(lvCount), lLast);
+}
+
+void apu_compact(uint16_t* lpList, int lCapacity, uint32_t* lpCount,
+                 const vec08u* src, int sstr,
+                 int bw, int bh)
+{
+   int    lCUs  = apuGetNumberOfCUs();
+   vec16u lZero = 0;
+   vec16u lOne  = 1;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      int    lY   = lpCount[2] + y;
+      vec16u lCnt = 0;
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         lCnt = lCnt + vselect(lOne, lZero, vsne(__builtin_convertvector(src[x], vec16u), lZero));
+      }
+
+      if (vany(vsne(lCnt, lZero)))
+      {
+         if (lpCount[0] >= (uint32_t)lCapacity)
+         {
+            lpCount[1] += compact_total(lCnt, lCUs - 1);
+         }
+         else
+         {
+            for (int cu = 0; cu < lCUs; ++cu)
+            {
+               if (vget(lCnt, cu) == 0)
+               {
+                  continue;
+               }
+               for (int x = 0; x < bw; ++x)
+               {
+                  int lValue = vget(src[x], cu);
+                  if (lValue != 0)
+                  {
+                     compact_emit(lpList, lCapacity, lpCount, cu * bw + x, lY, lValue);
+                  }
+               }
+            }
+         }
+      }
+      src += sstr;
+   }
+   lpCount[2] += bh;
+}
+
+void apu_compact(uint16_t* lpList, int lCapacity, uint32_t* lpCount,
+                 const vec16u* src, int sstr,
+                 int bw, int bh)
+{
+   int    lCUs  = apuGetNumberOfCUs();
+   vec16u lZero = 0;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      int    lY   = lpCount[2] + y;
+      vec16u lCnt = 0; // at most 16 * bw set pixels per CU
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         lCnt = lCnt + vpcnt(src[x]);
+      }
+
+      if (vany(vsne(lCnt, lZero)))
+      {
+         if (lpCount[0] >= (uint32_t)lCapacity)
+         {
+            lpCount[1] += compact_total(lCnt, lCUs - 1);
+         }
+         else
+         {
+            for (int cu = 0; cu < lCUs; ++cu)
+            {
+               if (vget(lCnt, cu) == 0)
+               {
+                  continue;
+               }
+               for (int x = 0; x < bw; ++x)
+               {
+                  int lWord = vget(src[x], cu);
+                  for (int b = 0; lWord != 0; ++b, lWord >>= 1)
+                  {
+                     if (lWord & 1)
+                     {
+                        compact_emit(lpList, lCapacity, lpCount, (cu * bw + x) * 16 + b, lY, 1);
+                     }
+                  }
+               }
+            }
+         }
+      }
+      src += sstr;
+   }
+   lpCount[2] += bh;
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
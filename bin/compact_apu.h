@@ -0,0 +1,65 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file compact_apu.h
+*  @brief APU implementation of the stream compaction kernels
+***********************************************************************************/
+
+#ifndef APUCOMPACTIMPL_H
+#define APUCOMPACTIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Appends (x, y, value) of the non zero pixels of a tile to a list
+*
+*  Points are appended in raster order. Each row first counts its set pixels per
+*  CU; rows without any are skipped with one vany, and only the CU chunks with
+*  a non zero count are read back lane by lane. Once the list is full the
+*  remaining points are only counted, from the row counts.
+*
+*  \param lpList     list of COMPACT_POINT_FIELDS uint16_t per point
+*  \param lCapacity  points lpList can hold
+*  \param lpCount    [0] points stored, [1] points found, [2] frame row of the
+*                    first tile row; all updated
+*  \param src        input tile
+*  \param sstr       stride in vec08u elements
+*  \param bw         chunk width
+*  \param bh         chunk height
+***********************************************************************************/
+void apu_compact(uint16_t* lpList, int lCapacity, uint32_t* lpCount,
+                 const vec08u* src, int sstr,
+                 int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief apu_compact() for a packed mask (see binary_mask_apu.h); value is 1
+*
+*  \param sstr  stride in vec16u elements
+*  \param bw    chunk width in 16 bit words
+***********************************************************************************/
+void apu_compact(uint16_t* lpList, int lCapacity, uint32_t* lpCount,
+                 const vec16u* src, int sstr,
+                 int bw, int bh);
+
+#endif /* APUCOMPACTIMPL_H */
@@ -0,0 +1,251 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file dither_acf.cpp
+* \addtogroup apexcv-dither
+* \addtogroup dither
+* \ingroup dither
+* @{
+* \brief dithering and noise
+*/
+
+/*!*********************************************************************************
+*  @file dither_acf.cpp
+*  @brief ACF metadata and wrapper functions for the dithering and noise kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "dither_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the random dither kernel (signed 16 bit in, unsigned 8 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(DITHER_RANDOM_16s_08u_K)
+(
+   DITHER_RANDOM_16s_08u_KN,
+   5,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(PARAMS),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(SEED),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(4),
+          __identifier("VEC_RAND_STATE"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the ordered dither kernel (signed 16 bit in, unsigned 8 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(DITHER_ORDERED_16s_08u_K)
+(
+   DITHER_ORDERED_16s_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(PARAMS),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the uniform noise kernel (unsigned 8 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(NOISE_UNIFORM_08u_K)
+(
+   NOISE_UNIFORM_08u_KN,
+   5,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(PARAMS),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(SEED),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(4),
+          __identifier("VEC_RAND_STATE"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "dither_acf.h"
+#include "dither_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the random dither kernel
+*
+*  PARAMS[0] is the right shift (0..15) from 16 to 8 bit. The per-CU generators
+*  in VEC_RAND_STATE are seeded from SEED on the first tile of every frame;
+*  change SEED between frames for a pattern that does not repeat.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void dither_random_16s_08u(kernel_io_desc lIn0, kernel_io_desc lParams, kernel_io_desc lSeed, kernel_io_desc lOut0, kernel_io_desc lvState)
+{
+   vec16s*   lpvIn0   = (vec16s*)lIn0.pMem;
+   uint8_t*  lpParams = (uint8_t*)lParams.pMem;
+   uint32_t* lpSeed   = (uint32_t*)lSeed.pMem;
+   vec08u*   lpvOut0  = (vec08u*)lOut0.pMem;
+   vrand32*  lpState  = (vrand32*)lvState.pMem;
+   int       lShift   = lpParams[0] & 15;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      vrand_seed(lpState, lpSeed[0]);
+   }
+   apu_dither_random( lpvOut0, lOut0.chunkSpan,
+                      lpvIn0, lIn0.chunkSpan / 2,
+                      lIn0.chunkWidth, lIn0.chunkHeight,
+                      lShift, lpState );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the ordered dither kernel
+*
+*  PARAMS[0] is the right shift (0..15) from 16 to 8 bit.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void dither_ordered_16s_08u(kernel_io_desc lIn0, kernel_io_desc lParams, kernel_io_desc lOut0)
+{
+   vec16s*  lpvIn0   = (vec16s*)lIn0.pMem;
+   uint8_t* lpParams = (uint8_t*)lParams.pMem;
+   vec08u*  lpvOut0  = (vec08u*)lOut0.pMem;
+
+   apu_dither_ordered( lpvOut0, lOut0.chunkSpan,
+                       lpvIn0, lIn0.chunkSpan / 2,
+                       lIn0.chunkWidth, lIn0.chunkHeight,
+                       lpParams[0] & 15 );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the uniform noise kernel
+*
+*  PARAMS[0] is the noise amplitude, clamped to 127; SEED seeds VEC_RAND_STATE
+*  as for dither_random_16s_08u.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void noise_uniform_08u(kernel_io_desc lIn0, kernel_io_desc lParams, kernel_io_desc lSeed, kernel_io_desc lOut0, kernel_io_desc lvState)
+{
+   vec08u*   lpvIn0   = (vec08u*)lIn0.pMem;
+   uint8_t*  lpParams = (uint8_t*)lParams.pMem;
+   uint32_t* lpSeed   = (uint32_t*)lSeed.pMem;
+   vec08u*   lpvOut0  = (vec08u*)lOut0.pMem;
+   vrand32*  lpState  = (vrand32*)lvState.pMem;
+   int       lAmp     = (lpParams[0] > 127) ? 127 : lpParams[0];
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      vrand_seed(lpState, lpSeed[0]);
+   }
+   apu_noise_uniform( lpvOut0, lOut0.chunkSpan,
+                      lpvIn0, lIn0.chunkSpan,
+                      lIn0.chunkWidth, lIn0.chunkHeight,
+                      lAmp, lpState );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
@@ -0,0 +1,46 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file dither_acf.h
+*  @brief Kernel identifiers for the dithering and noise kernels
+***********************************************************************************/
+
+#ifndef DITHERACF_H
+#define DITHERACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define OUTPUT_0                        "OUTPUT_0"
+#define PARAMS                          "PARAMS"
+#define SEED                            "SEED"
+
+#define DITHER_RANDOM_16s_08u_K         dither_random_16s_08u
+#define DITHER_RANDOM_16s_08u_KN        "dither_random_16s_08u"
+
+#define DITHER_ORDERED_16s_08u_K        dither_ordered_16s_08u
+#define DITHER_ORDERED_16s_08u_KN       "dither_ordered_16s_08u"
+
+#define NOISE_UNIFORM_08u_K             noise_uniform_08u
+#define NOISE_UNIFORM_08u_KN            "noise_uniform_08u"
+
+#endif /* DITHERACF_H */
@@ -0,0 +1,129 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file dither_apu.cpp
+*  @brief APU implementation of the dithering and noise kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "dither_apu.h"
+
+/*! 4x4 Bayer threshold matrix, values 0..15 */
+static const uint8_t gDitherBayer4[4][4] =
+{
+   {  0,  8,  2, 10 },
+   { 12,  4, 14,  6 },
+   {  3, 11,  1,  9 },
+   { 15,  7, 13,  5 }
+};
+
+/*!*********************************************************************************
+*  \brief sat8((x + n) >> lShift)
+***********************************************************************************/
+static inline vec08u dither_narrow(vec16s x, vec16s n, vec16s lShift)
+{
+   vec16s lV    = vadd_sat(x, n) >> lShift;
+   vec16s lZero = 0;
+   vec16s lMax  = 255;
+
+   lV = vselect(lZero, lV, vsgt(lZero, lV));
+   lV = vselect(lMax, lV, vsgt(lV, lMax));
+   return __builtin_convertvector(lV, vec08u);
+}
+
+void apu_dither_random(vec08u* dst, int dstr,
+                       const vec16s* src, int sstr,
+                       int bw, int bh,
+                       int lShift, vrand32* lpState)
+{
+   vec16s  lShiftV = (vec16s)lShift;
+   vec16u  lDrop   = (vec16u)(15 - lShift);
+   vrand32 lState  = *lpState;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         // the top lShift bits of the scrambled output, taken in two steps so
+         // that lShift 0 needs no 16 bit shift
+         vec16s lN = (vec16s)((vrand_next16(&lState) >> (vec16u)1) >> lDrop);
+         dst[x] = dither_narrow(src[x], lN, lShiftV);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+   *lpState = lState;
+}
+
+void apu_dither_ordered(vec08u* dst, int dstr,
+                        const vec16s* src, int sstr,
+                        int bw, int bh,
+                        int lShift)
+{
+   vec16s lShiftV = (vec16s)lShift;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      const uint8_t* lpBayer = gDitherBayer4[y & 3];
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16s lN = (vec16s)((lpBayer[x & 3] << lShift) >> 4);
+         dst[x] = dither_narrow(src[x], lN, lShiftV);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_noise_uniform(vec08u* dst, int dstr,
+                       const vec08u* src, int sstr,
+                       int bw, int bh,
+                       int lAmplitude, vrand32* lpState)
+{
+   vec16u  lSpan  = (vec16u)(2 * lAmplitude + 1);
+   vec16s  lAmp   = (vec16s)lAmplitude;
+   vec16s  lZero  = 0;
+   vec16s  lMax   = 255;
+   vrand32 lState = *lpState;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         // 8 random bits times at most 255 values still fits 16 bits
+         vec16u lR = vrand_next16(&lState) >> (vec16u)8;
+         vec16s lN = (vec16s)((lR * lSpan) >> (vec16u)8) - lAmp;
+         vec16s lV = __builtin_convertvector(__builtin_convertvector(src[x], vec16u), vec16s) + lN;
+         lV = vselect(lZero, lV, vsgt(lZero, lV));
+         lV = vselect(lMax, lV, vsgt(lV, lMax));
+         dst[x] = __builtin_convertvector(lV, vec08u);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+   *lpState = lState;
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
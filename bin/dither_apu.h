@@ -0,0 +1,80 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file dither_apu.h
+*  @brief APU implementation of the dithering and noise kernels
+***********************************************************************************/
+
+#ifndef APUDITHERIMPL_H
+#define APUDITHERIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Narrows 16 bit to 8 bit with random dithering
+*
+*  out = sat8((x + n) >> lShift), n uniform in [0, 2^lShift), drawn per pixel
+*  from the per-CU generators in lpState (see vrand.h). The expected output is
+*  x / 2^lShift, without the banding of plain truncation.
+*
+*  \param dst      output tile
+*  \param dstr     output stride in vec08u elements
+*  \param src      input tile
+*  \param sstr     input stride in vec16s elements
+*  \param bw       chunk width
+*  \param bh       chunk height
+*  \param lShift   right shift, 0..15
+*  \param lpState  generator state, kept between tiles
+***********************************************************************************/
+void apu_dither_random(vec08u* dst, int dstr,
+                       const vec16s* src, int sstr,
+                       int bw, int bh,
+                       int lShift, vrand32* lpState);
+
+/*!*********************************************************************************
+*  \brief Narrows 16 bit to 8 bit with a 4x4 Bayer ordered dither
+*
+*  As apu_dither_random() with n taken from the Bayer matrix at (x & 3, y & 3)
+*  of the tile, scaled to [0, 2^lShift). The pattern is continuous over the
+*  frame when bw and bh are multiples of 4.
+***********************************************************************************/
+void apu_dither_ordered(vec08u* dst, int dstr,
+                        const vec16s* src, int sstr,
+                        int bw, int bh,
+                        int lShift);
+
+/*!*********************************************************************************
+*  \brief Adds uniform noise in [-lAmplitude, lAmplitude] to an 8 bit image
+*
+*  The result saturates to 0..255. Meant for synthetic test input.
+*
+*  \param lAmplitude  0..127
+*  \param lpState     generator state, kept between tiles
+***********************************************************************************/
+void apu_noise_uniform(vec08u* dst, int dstr,
+                       const vec08u* src, int sstr,
+                       int bw, int bh,
+                       int lAmplitude, vrand32* lpState);
+
+#endif /* APUDITHERIMPL_H */
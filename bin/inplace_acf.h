@@ -0,0 +1,64 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file inplace_acf.h
+*  @brief In-place capability metadata shared by the kernel families
+***********************************************************************************/
+
+#ifndef INPLACEACF_H
+#define INPLACEACF_H
+
+/*!*********************************************************************************
+*  \brief Input/output port pair of a kernel that may be bound to one CMEM buffer
+*
+*  The graph may alias the two ports when the input is not consumed by any other
+*  kernel after this one. The listed kernels read every element before writing
+*  the same position, so the regular implementation runs unchanged on the
+*  aliased buffer.
+***********************************************************************************/
+typedef struct
+{
+   const char* mpKernelName;  /*!< kernel name, as in the KERNEL_INFO */
+   int         mInPortIdx;    /*!< index of the input port that may be overwritten */
+   int         mOutPortIdx;   /*!< index of the output port that overwrites it */
+} ACF_INPLACE_PORT_PAIR;
+
+/*!*********************************************************************************
+*  \brief In-place tables of the kernel families, defined next to their KERNEL_INFO
+*
+*  The graph builder walks these tables to decide which port pairs it may bind to
+*  one buffer; each table has the matching element count next to it.
+***********************************************************************************/
+extern const ACF_INPLACE_PORT_PAIR gArithmeticInplacePorts[];
+extern const int                   gArithmeticInplacePortsCount;
+extern const ACF_INPLACE_PORT_PAIR gBackgroundSubInplacePorts[];
+extern const int                   gBackgroundSubInplacePortsCount;
+extern const ACF_INPLACE_PORT_PAIR gRaggedTileInplacePorts[];
+extern const int                   gRaggedTileInplacePortsCount;
+extern const ACF_INPLACE_PORT_PAIR gSortInplacePorts[];
+extern const int                   gSortInplacePortsCount;
+extern const ACF_INPLACE_PORT_PAIR gTemporalStatsInplacePorts[];
+extern const int                   gTemporalStatsInplacePortsCount;
+
+#endif /* INPLACEACF_H */
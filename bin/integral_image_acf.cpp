@@ -0,0 +1,157 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file integral_image_acf.cpp
+* \addtogroup apexcv-integral_image
+* \addtogroup integral_image
+* \ingroup integral_image
+* @{
+* \brief integral image and squared integral image
+*/
+
+/*!*********************************************************************************
+*  @file integral_image_acf.cpp
+*  @brief ACF metadata and wrapper function for the integral image kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "integral_image_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the integral image kernel (unsigned 8 bit in, 32 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(INTEGRAL_IMAGE_08u_K)
+(
+   INTEGRAL_IMAGE_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(VEC_CARRY),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the squared integral image kernel (unsigned 8 bit in, 32 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(INTEGRAL_IMAGE_SQRD_08u_K)
+(
+   INTEGRAL_IMAGE_SQRD_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(VEC_CARRY),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "integral_image_acf.h"
+#include "integral_image_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the integral image kernel
+*
+*  The column partials are carried between tiles in VEC_CARRY, so the tiles must
+*  be processed top to bottom. VEC_CARRY is a static port without a fixed size:
+*  it follows the chunk geometry, so its first row always holds the chunkWidth
+*  partials of the CU whatever chunk width the graph selects.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void integral_image_08u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvCarry)
+{
+   vec08u* lpvIn0   = (vec08u*)lIn0.pMem;
+   vec32u* lpvOut0  = (vec32u*)lOut0.pMem;
+   vec32u* lpvCarry = (vec32u*)lvCarry.pMem;
+
+   apu_integral_image( lpvOut0, lOut0.chunkSpan / 4,
+                       lpvIn0, lIn0.chunkSpan,
+                       lIn0.chunkWidth, lIn0.chunkHeight,
+                       lpvCarry, ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG) );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the squared integral image kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void integral_image_squared_08u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvCarry)
+{
+   vec08u* lpvIn0   = (vec08u*)lIn0.pMem;
+   vec32u* lpvOut0  = (vec32u*)lOut0.pMem;
+   vec32u* lpvCarry = (vec32u*)lvCarry.pMem;
+
+   apu_integral_image_squared( lpvOut0, lOut0.chunkSpan / 4,
+                               lpvIn0, lIn0.chunkSpan,
+                               lIn0.chunkWidth, lIn0.chunkHeight,
+                               lpvCarry, ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG) );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
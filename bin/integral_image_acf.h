@@ -0,0 +1,42 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file integral_image_acf.h
+*  @brief Kernel identifiers for the integral image kernels
+***********************************************************************************/
+
+#ifndef INTEGRALIMAGEACF_H
+#define INTEGRALIMAGEACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define OUTPUT_0                        "OUTPUT_0"
+#define VEC_CARRY                       "VEC_CARRY"
+
+#define INTEGRAL_IMAGE_08u_K            integral_image_08u
+#define INTEGRAL_IMAGE_08u_KN           "integral_image_08u"
+
+#define INTEGRAL_IMAGE_SQRD_08u_K       integral_image_squared_08u
+#define INTEGRAL_IMAGE_SQRD_08u_KN      "integral_image_squared_08u"
+
+#endif /* INTEGRALIMAGEACF_H */
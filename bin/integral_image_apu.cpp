@@ -0,0 +1,110 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file integral_image_apu.cpp
+*  @brief APU implementation of the integral image kernels
+*
+*  Each CU owns bw adjacent columns. A tile row is processed in two passes:
+*  the first builds the row prefix inside the CU chunk, the second adds the
+*  row totals of all CUs to the left (vscan_excl) and the column partials
+*  carried down from the rows above.
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "integral_image_apu.h"
+
+/*!*********************************************************************************
+*  \brief Adds the cross-CU row offset and the column carry to the in-CU row prefix
+***********************************************************************************/
+static void integral_finish_row(vec32u* dst, vec32u* lpvCarry, int bw, vec32u lRowTotal)
+{
+   vec32u lOffset = vscan_excl(lRowTotal);
+
+   for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+   {
+      vec32u lCol = lpvCarry[x] + dst[x] + lOffset;
+      lpvCarry[x] = lCol;
+      dst[x]      = lCol;
+   }
+}
+
+void apu_integral_image(vec32u* dst, int dstr,
+                        const vec08u* src, int sstr,
+                        int bw, int bh,
+                        vec32u* lpvCarry, bool lFirst)
+{
+   if (lFirst)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,)
+      {
+         lpvCarry[x] = 0;
+      }
+   }
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      vec32u lRow = 0;
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vacl(lRow, __builtin_convertvector(src[x], vec16u));
+         dst[x] = lRow;
+      }
+      integral_finish_row(dst, lpvCarry, bw, lRow);
+
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_integral_image_squared(vec32u* dst, int dstr,
+                                const vec08u* src, int sstr,
+                                int bw, int bh,
+                                vec32u* lpvCarry, bool lFirst)
+{
+   if (lFirst)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,)
+      {
+         lpvCarry[x] = 0;
+      }
+   }
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      vec32u lRow = 0;
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lPix = __builtin_convertvector(src[x], vec16u);
+         vacl(lRow, lPix * lPix); // 255^2 still fits the 16 bit lane
+         dst[x] = lRow;
+      }
+      integral_finish_row(dst, lpvCarry, bw, lRow);
+
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
@@ -0,0 +1,67 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file integral_image_apu.h
+*  @brief APU implementation of the integral image kernels
+***********************************************************************************/
+
+#ifndef APUINTEGRALIMAGEIMPL_H
+#define APUINTEGRALIMAGEIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Integral image of one tile (sum of all pixels above and left, inclusive)
+*
+*  The column partials of the last row of the previous tile are kept in lpvCarry,
+*  the row partials of the CUs to the left are propagated across the CU array.
+*  Sums are 32 bit and do not overflow for frames up to 16 Mpixel.
+*
+*  \param dst      output tile (32 bit)
+*  \param dstr     output stride in vec32u elements
+*  \param src      input tile (8 bit)
+*  \param sstr     input stride in vec08u elements
+*  \param bw       chunk width
+*  \param bh       chunk height
+*  \param lpvCarry column carry buffer of at least bw elements, kept between tiles
+*  \param lFirst   true for the first tile of the frame (clears the carry)
+***********************************************************************************/
+void apu_integral_image(vec32u* dst, int dstr,
+                        const vec08u* src, int sstr,
+                        int bw, int bh,
+                        vec32u* lpvCarry, bool lFirst);
+
+/*!*********************************************************************************
+*  \brief Squared integral image of one tile (sum of squared pixels above and left)
+*
+*  Same carry scheme as apu_integral_image(). The 32 bit sums wrap for large
+*  frames; box sums computed from four corners stay exact as long as the box
+*  itself holds less than 2^32 / 255^2 (66051) pixels.
+***********************************************************************************/
+void apu_integral_image_squared(vec32u* dst, int dstr,
+                                const vec08u* src, int sstr,
+                                int bw, int bh,
+                                vec32u* lpvCarry, bool lFirst);
+
+#endif /* APUINTEGRALIMAGEIMPL_H */
@@ -0,0 +1,335 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file mac_filter_acf.cpp
+* \addtogroup apexcv-mac_filter
+* \addtogroup mac_filter
+* \ingroup mac_filter
+* @{
+* \brief multiply-accumulate filters: FIR, convolution and small GEMM
+*/
+
+/*!*********************************************************************************
+*  @file mac_filter_acf.cpp
+*  @brief ACF metadata and wrapper functions for the multiply-accumulate filter kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "mac_filter_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the FIR kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(FIR_16s_K)
+(
+   FIR_16s_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(FIR_MAX_TAPS/2,FIR_MAX_TAPS/2,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(FIR_MAX_TAPS, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(3),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 3x3 convolution kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CONVOLVE_3x3_16s_K)
+(
+   CONVOLVE_3x3_16s_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(9, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 5x5 convolution kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CONVOLVE_5x5_16s_K)
+(
+   CONVOLVE_5x5_16s_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(25, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the GEMM kernel (signed 8 bit in, signed 32 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(GEMM_08s_K)
+(
+   GEMM_08s_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(1, 1),
+          __ek_size(1, GEMM_K)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08s),
+          __e0_size(1, 1),
+          __ek_size(GEMM_M * GEMM_K, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32s),
+          __e0_size(1, 1),
+          __ek_size(1, GEMM_M))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the GEMM kernel (signed 16 bit in, signed 32 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(GEMM_16s_K)
+(
+   GEMM_16s_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, GEMM_K)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(GEMM_M * GEMM_K, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32s),
+          __e0_size(1, 1),
+          __ek_size(1, GEMM_M))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "mac_filter_acf.h"
+#include "mac_filter_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the FIR kernel (signed 16 bit)
+*
+*  INPUT_1 holds the coefficients, INPUT_2[0] the (odd) number of taps and
+*  INPUT_2[1] the right shift of the result. An even tap count is rounded up,
+*  the count is clamped to FIR_MAX_TAPS and the shift to 31.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void fir_16s(kernel_io_desc lIn0, kernel_io_desc lCoef, kernel_io_desc lParams, kernel_io_desc lOut0)
+{
+   vec16s*  lpvIn0   = (vec16s*)lIn0.pMem;
+   int16_t* lpCoef   = (int16_t*)lCoef.pMem;
+   uint8_t* lpParams = (uint8_t*)lParams.pMem;
+   vec16s*  lpvOut0  = (vec16s*)lOut0.pMem;
+
+   // an odd tap count in 1..FIR_MAX_TAPS keeps the window centred and inside
+   // the coefficient port and the spatial border
+   int lTaps  = (lpParams[0] > FIR_MAX_TAPS) ? FIR_MAX_TAPS : (lpParams[0] | 1);
+   int lShift = (lpParams[1] > 31) ? 31 : lpParams[1];
+
+   apu_fir( lpvOut0, lOut0.chunkSpan / 2,
+            lpvIn0, lIn0.chunkSpan / 2,
+            lIn0.chunkWidth, lIn0.chunkHeight,
+            lpCoef, lTaps, lShift );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 3x3 convolution kernel (signed 16 bit)
+*
+*  INPUT_1 holds the row major coefficients, INPUT_2[0] the right shift of
+*  the result.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void convolve_3x3_16s(kernel_io_desc lIn0, kernel_io_desc lCoef, kernel_io_desc lShift, kernel_io_desc lOut0)
+{
+   vec16s*  lpvIn0  = (vec16s*)lIn0.pMem;
+   int16_t* lpCoef  = (int16_t*)lCoef.pMem;
+   uint8_t* lpShift = (uint8_t*)lShift.pMem;
+   vec16s*  lpvOut0 = (vec16s*)lOut0.pMem;
+
+   apu_convolve_3x3( lpvOut0, lOut0.chunkSpan / 2,
+                     lpvIn0, lIn0.chunkSpan / 2,
+                     lIn0.chunkWidth, lIn0.chunkHeight,
+                     lpCoef, (lpShift[0] > 31) ? 31 : lpShift[0] );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 5x5 convolution kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void convolve_5x5_16s(kernel_io_desc lIn0, kernel_io_desc lCoef, kernel_io_desc lShift, kernel_io_desc lOut0)
+{
+   vec16s*  lpvIn0  = (vec16s*)lIn0.pMem;
+   int16_t* lpCoef  = (int16_t*)lCoef.pMem;
+   uint8_t* lpShift = (uint8_t*)lShift.pMem;
+   vec16s*  lpvOut0 = (vec16s*)lOut0.pMem;
+
+   apu_convolve_5x5( lpvOut0, lOut0.chunkSpan / 2,
+                     lpvIn0, lIn0.chunkSpan / 2,
+                     lIn0.chunkWidth, lIn0.chunkHeight,
+                     lpCoef, (lpShift[0] > 31) ? 31 : lpShift[0] );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the GEMM kernel (signed 8 bit)
+*
+*  INPUT_0 carries B, GEMM_K lines per block; INPUT_1 carries A (GEMM_M x
+*  GEMM_K, row major). Each block yields GEMM_M lines of C.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void gemm_08s(kernel_io_desc lIn0, kernel_io_desc lMatA, kernel_io_desc lOut0)
+{
+   vec08s* lpvIn0  = (vec08s*)lIn0.pMem;
+   int8_t* lpA     = (int8_t*)lMatA.pMem;
+   vec32s* lpvOut0 = (vec32s*)lOut0.pMem;
+
+   apu_gemm( lpvOut0, lOut0.chunkSpan / 4,
+             lpvIn0, lIn0.chunkSpan,
+             lIn0.chunkWidth, lIn0.chunkHeight,
+             lpA );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the GEMM kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void gemm_16s(kernel_io_desc lIn0, kernel_io_desc lMatA, kernel_io_desc lOut0)
+{
+   vec16s*  lpvIn0  = (vec16s*)lIn0.pMem;
+   int16_t* lpA     = (int16_t*)lMatA.pMem;
+   vec32s*  lpvOut0 = (vec32s*)lOut0.pMem;
+
+   apu_gemm( lpvOut0, lOut0.chunkSpan / 4,
+             lpvIn0, lIn0.chunkSpan / 2,
+             lIn0.chunkWidth, lIn0.chunkHeight,
+             lpA );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
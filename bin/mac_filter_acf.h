@@ -0,0 +1,59 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file mac_filter_acf.h
+*  @brief Kernel identifiers for the multiply-accumulate filter kernels
+***********************************************************************************/
+
+#ifndef MACFILTERACF_H
+#define MACFILTERACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define INPUT_1                         "INPUT_1"
+#define INPUT_2                         "INPUT_2"
+#define OUTPUT_0                        "OUTPUT_0"
+
+/*! Longest (odd) FIR the fir kernel accepts; sets its spatial dependency */
+#define FIR_MAX_TAPS                    15
+
+/*! GEMM shape: C[GEMM_M x n] = A[GEMM_M x GEMM_K] * B[GEMM_K x n] */
+#define GEMM_M                          16
+#define GEMM_K                          16
+
+#define FIR_16s_K                       fir_16s
+#define FIR_16s_KN                      "fir_16s"
+
+#define CONVOLVE_3x3_16s_K              convolve_3x3_16s
+#define CONVOLVE_3x3_16s_KN             "convolve_3x3_16s"
+
+#define CONVOLVE_5x5_16s_K              convolve_5x5_16s
+#define CONVOLVE_5x5_16s_KN             "convolve_5x5_16s"
+
+#define GEMM_08s_K                      gemm_08s
+#define GEMM_08s_KN                     "gemm_08s"
+
+#define GEMM_16s_K                      gemm_16s
+#define GEMM_16s_KN                     "gemm_16s"
+
+#endif /* MACFILTERACF_H */
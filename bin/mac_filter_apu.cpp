@@ -0,0 +1,176 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file mac_filter_apu.cpp
+*  @brief APU implementation of the multiply-accumulate filter kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "mac_filter_apu.h"
+#include "mac_filter_acf.h"
+
+void apu_fir(vec16s* dst, int dstr,
+             const vec16s* src, int sstr,
+             int bw, int bh,
+             const int16_t* lpCoef, int lTaps, int lShift)
+{
+   const vec16s* lpSrc = src - (lTaps >> 1);
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vacc32s lAcc;
+         vacc_clear(&lAcc);
+         for (int t = 0; t < lTaps; ++t) chess_loop_range(1,)
+         {
+            vacc_mac(&lAcc, lpSrc[x + t], (vec16s)lpCoef[t]);
+         }
+         dst[x] = vacc_narrow(lAcc, lShift);
+      }
+      lpSrc += sstr;
+      dst   += dstr;
+   }
+}
+
+/*!*********************************************************************************
+*  \brief NxN convolution, coefficients row major
+***********************************************************************************/
+template<int N>
+static void convolve_tile(vec16s* dst, int dstr,
+                          const vec16s* src, int sstr,
+                          int bw, int bh,
+                          const int16_t* lpCoef, int lShift)
+{
+   const vec16s* lpSrc = src - (N >> 1) * sstr - (N >> 1);
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vacc32s lAcc;
+         vacc_clear(&lAcc);
+         apex_unroll_loop_full
+         for (int ky = 0; ky < N; ++ky)
+         {
+            apex_unroll_loop_full
+            for (int kx = 0; kx < N; ++kx)
+            {
+               vacc_mac(&lAcc, lpSrc[ky * sstr + x + kx], (vec16s)lpCoef[ky * N + kx]);
+            }
+         }
+         dst[x] = vacc_narrow(lAcc, lShift);
+      }
+      lpSrc += sstr;
+      dst   += dstr;
+   }
+}
+
+void apu_convolve_3x3(vec16s* dst, int dstr,
+                      const vec16s* src, int sstr,
+                      int bw, int bh,
+                      const int16_t* lpCoef, int lShift)
+{
+   convolve_tile<3>(dst, dstr, src, sstr, bw, bh, lpCoef, lShift);
+}
+
+void apu_convolve_5x5(vec16s* dst, int dstr,
+                      const vec16s* src, int sstr,
+                      int bw, int bh,
+                      const int16_t* lpCoef, int lShift)
+{
+   convolve_tile<5>(dst, dstr, src, sstr, bw, bh, lpCoef, lShift);
+}
+
+/*!*********************************************************************************
+*  \brief acc += b * a for 16 bit operands: the full 16x16 product
+***********************************************************************************/
+static inline void gemm_mac(vacc32s* lpAcc, vec16s b, int16_t a)
+{
+   vacc_mac(lpAcc, b, (vec16s)a);
+}
+
+/*!*********************************************************************************
+*  \brief acc += b * a for int8 operands
+*
+*  Both factors fit the low byte, so a single low x low partial product is the
+*  whole product, as in cnn_mac (cnn_apu.cpp).
+***********************************************************************************/
+static inline void gemm_mac(vacc32s* lpAcc, vec08s b, int8_t a)
+{
+   vacc_acl(lpAcc, vmul_slsl(__builtin_convertvector(b, vec16s), (vec16s)a));
+}
+
+/*!*********************************************************************************
+*  \brief GEMM over the blocks of a tile; T is the element type of B, C the
+*         type of the A coefficients
+***********************************************************************************/
+template<typename T, typename C>
+static void gemm_tile(vec32s* dst, int dstr,
+                      const T* src, int sstr,
+                      int bw, int bh,
+                      const C* lpA)
+{
+   int lBlocks = bh / GEMM_K;
+
+   for (int b = 0; b < lBlocks; ++b) chess_loop_range(1,)
+   {
+      for (int m = 0; m < GEMM_M; ++m) chess_loop_range(1,)
+      {
+         const C* lpRow = lpA + m * GEMM_K;
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            vacc32s lAcc;
+            vacc_clear(&lAcc);
+            apex_unroll_loop_full
+            for (int k = 0; k < GEMM_K; ++k)
+            {
+               gemm_mac(&lAcc, src[k * sstr + x], lpRow[k]);
+            }
+            dst[x] = vacc_get(lAcc);
+         }
+         dst += dstr;
+      }
+      src += GEMM_K * sstr;
+   }
+}
+
+void apu_gemm(vec32s* dst, int dstr,
+              const vec16s* src, int sstr,
+              int bw, int bh,
+              const int16_t* lpA)
+{
+   gemm_tile(dst, dstr, src, sstr, bw, bh, lpA);
+}
+
+void apu_gemm(vec32s* dst, int dstr,
+              const vec08s* src, int sstr,
+              int bw, int bh,
+              const int8_t* lpA)
+{
+   gemm_tile(dst, dstr, src, sstr, bw, bh, lpA);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
@@ -0,0 +1,97 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file mac_filter_apu.h
+*  @brief APU implementation of the multiply-accumulate filter kernels
+*
+*  Coefficients are scalars in DMEM and are broadcast to all CUs one per
+*  multiply-accumulate step; sums are kept in split 32 bit accumulators
+*  (vacc32s).
+***********************************************************************************/
+
+#ifndef APUMACFILTERIMPL_H
+#define APUMACFILTERIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Horizontal FIR, dst = sat16((sum_t coef[t] * src[x + t - taps / 2]) >> shift)
+*
+*  \param dst    output tile
+*  \param dstr   output stride in vec16s elements
+*  \param src    input tile with taps / 2 pixels of border left and right
+*  \param sstr   input stride in vec16s elements
+*  \param bw     chunk width
+*  \param bh     chunk height
+*  \param lpCoef lTaps coefficients
+*  \param lTaps  odd number of taps, at most FIR_MAX_TAPS
+*  \param lShift right shift applied before saturation
+***********************************************************************************/
+void apu_fir(vec16s* dst, int dstr,
+             const vec16s* src, int sstr,
+             int bw, int bh,
+             const int16_t* lpCoef, int lTaps, int lShift);
+
+/*!*********************************************************************************
+*  \brief 3x3 convolution with int16 coefficients (row major), result shifted
+*         right by lShift and saturated to 16 bit
+***********************************************************************************/
+void apu_convolve_3x3(vec16s* dst, int dstr,
+                      const vec16s* src, int sstr,
+                      int bw, int bh,
+                      const int16_t* lpCoef, int lShift);
+
+/*!*********************************************************************************
+*  \brief 5x5 convolution, see apu_convolve_3x3()
+***********************************************************************************/
+void apu_convolve_5x5(vec16s* dst, int dstr,
+                      const vec16s* src, int sstr,
+                      int bw, int bh,
+                      const int16_t* lpCoef, int lShift);
+
+/*!*********************************************************************************
+*  \brief Small GEMM, C = A * B, one column of B and C per pixel
+*
+*  Every GEMM_K lines of src hold one block of B; each produces GEMM_M lines
+*  of full 32 bit sums in dst.
+*
+*  \param dst  output tile (bh / GEMM_K * GEMM_M lines)
+*  \param dstr output stride in vec32s elements
+*  \param src  input tile (multiple of GEMM_K lines)
+*  \param sstr input stride in elements
+*  \param bw   chunk width
+*  \param bh   chunk height of src
+*  \param lpA  GEMM_M x GEMM_K matrix, row major
+***********************************************************************************/
+void apu_gemm(vec32s* dst, int dstr,
+              const vec16s* src, int sstr,
+              int bw, int bh,
+              const int16_t* lpA);
+
+void apu_gemm(vec32s* dst, int dstr,
+              const vec08s* src, int sstr,
+              int bw, int bh,
+              const int8_t* lpA);
+
+#endif /* APUMACFILTERIMPL_H */
@@ -0,0 +1,1017 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file morphology_acf.cpp
+* \addtogroup apexcv-morphology
+* \addtogroup morphology
+* \ingroup morphology
+* @{
+* \brief morphology (erosion, dilation, opening, closing)
+*/
+
+/*!*********************************************************************************
+*  @file morphology_acf.cpp
+*  @brief ACF metadata and wrapper functions for the morphology kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "morphology_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the erosion kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(ERODE_3x3_08u_K)
+(
+   ERODE_3x3_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the erosion kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(ERODE_CROSS_08u_K)
+(
+   ERODE_CROSS_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the dilation kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(DILATE_3x3_08u_K)
+(
+   DILATE_3x3_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the dilation kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(DILATE_CROSS_08u_K)
+(
+   DILATE_CROSS_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the opening kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(OPEN_3x3_08u_K)
+(
+   OPEN_3x3_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the opening kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(OPEN_CROSS_08u_K)
+(
+   OPEN_CROSS_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the closing kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CLOSE_3x3_08u_K)
+(
+   CLOSE_3x3_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the closing kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CLOSE_CROSS_08u_K)
+(
+   CLOSE_CROSS_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the erosion kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(ERODE_3x3_1u_K)
+(
+   ERODE_3x3_1u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the erosion kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(ERODE_CROSS_1u_K)
+(
+   ERODE_CROSS_1u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the dilation kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(DILATE_3x3_1u_K)
+(
+   DILATE_3x3_1u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the dilation kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(DILATE_CROSS_1u_K)
+(
+   DILATE_CROSS_1u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the opening kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(OPEN_3x3_1u_K)
+(
+   OPEN_3x3_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the opening kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(OPEN_CROSS_1u_K)
+(
+   OPEN_CROSS_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the closing kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CLOSE_3x3_1u_K)
+(
+   CLOSE_3x3_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the closing kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CLOSE_CROSS_1u_K)
+(
+   CLOSE_CROSS_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the gated opening kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(OPEN_3x3_GATED_08u_K)
+(
+   OPEN_3x3_GATED_08u_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(ACTIVE),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the gated closing kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CLOSE_3x3_GATED_08u_K)
+(
+   CLOSE_3x3_GATED_08u_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(ACTIVE),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the gated opening kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(OPEN_3x3_GATED_1u_K)
+(
+   OPEN_3x3_GATED_1u_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(ACTIVE),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the gated closing kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(CLOSE_3x3_GATED_1u_K)
+(
+   CLOSE_3x3_GATED_1u_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(ACTIVE),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier("VEC_RING"),
+          __attributes(ACF_ATTR_VEC_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(MORPHOLOGY_RING_SIZE, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "morphology_acf.h"
+#include "morphology_apu.h"
+#include "tile_activity_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the erosion kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void erode_3x3_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_erode_3x3( lpvOut0, lOut0.chunkSpan,
+                  lpvIn0, lIn0.chunkSpan,
+                  lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the erosion kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void erode_cross_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_erode_cross( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan,
+                    lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the dilation kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void dilate_3x3_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_dilate_3x3( lpvOut0, lOut0.chunkSpan,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the dilation kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void dilate_cross_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_dilate_cross( lpvOut0, lOut0.chunkSpan,
+                     lpvIn0, lIn0.chunkSpan,
+                     lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the opening kernel (3x3 square element, 8 bit mask)
+*
+*  VEC_RING holds the eroded rows between the two passes. It is sized for
+*  MORPHOLOGY_MAX_CHUNK_WIDTH; wider chunks are processed in strips of that
+*  width. The same holds for all fused kernels.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void open_3x3_08u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+   vec08u* lpvRing = (vec08u*)lvRing.pMem;
+
+   apu_open_3x3( lpvOut0, lOut0.chunkSpan,
+                 lpvIn0, lIn0.chunkSpan,
+                 lIn0.chunkWidth, lIn0.chunkHeight,
+                 lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the opening kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void open_cross_08u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+   vec08u* lpvRing = (vec08u*)lvRing.pMem;
+
+   apu_open_cross( lpvOut0, lOut0.chunkSpan,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight,
+                   lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the closing kernel (3x3 square element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void close_3x3_08u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+   vec08u* lpvRing = (vec08u*)lvRing.pMem;
+
+   apu_close_3x3( lpvOut0, lOut0.chunkSpan,
+                  lpvIn0, lIn0.chunkSpan,
+                  lIn0.chunkWidth, lIn0.chunkHeight,
+                  lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the closing kernel (3x3 cross element, 8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void close_cross_08u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+   vec08u* lpvRing = (vec08u*)lvRing.pMem;
+
+   apu_close_cross( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan,
+                    lIn0.chunkWidth, lIn0.chunkHeight,
+                    lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the erosion kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void erode_3x3_1u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_erode_3x3( lpvOut0, lOut0.chunkSpan / 2,
+                  lpvIn0, lIn0.chunkSpan / 2,
+                  lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the erosion kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void erode_cross_1u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_erode_cross( lpvOut0, lOut0.chunkSpan / 2,
+                    lpvIn0, lIn0.chunkSpan / 2,
+                    lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the dilation kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void dilate_3x3_1u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_dilate_3x3( lpvOut0, lOut0.chunkSpan / 2,
+                   lpvIn0, lIn0.chunkSpan / 2,
+                   lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the dilation kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void dilate_cross_1u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_dilate_cross( lpvOut0, lOut0.chunkSpan / 2,
+                     lpvIn0, lIn0.chunkSpan / 2,
+                     lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the opening kernel (3x3 square element, packed mask)
+*
+*  VEC_RING holds the eroded rows between the two passes. It is sized for
+*  MORPHOLOGY_MAX_CHUNK_WIDTH; wider chunks are processed in strips of that
+*  width. The same holds for all fused kernels.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void open_3x3_1u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+   vec16u* lpvRing = (vec16u*)lvRing.pMem;
+
+   apu_open_3x3( lpvOut0, lOut0.chunkSpan / 2,
+                 lpvIn0, lIn0.chunkSpan / 2,
+                 lIn0.chunkWidth, lIn0.chunkHeight,
+                 lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the opening kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void open_cross_1u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+   vec16u* lpvRing = (vec16u*)lvRing.pMem;
+
+   apu_open_cross( lpvOut0, lOut0.chunkSpan / 2,
+                   lpvIn0, lIn0.chunkSpan / 2,
+                   lIn0.chunkWidth, lIn0.chunkHeight,
+                   lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the closing kernel (3x3 square element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void close_3x3_1u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+   vec16u* lpvRing = (vec16u*)lvRing.pMem;
+
+   apu_close_3x3( lpvOut0, lOut0.chunkSpan / 2,
+                  lpvIn0, lIn0.chunkSpan / 2,
+                  lIn0.chunkWidth, lIn0.chunkHeight,
+                  lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the closing kernel (3x3 cross element, packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void close_cross_1u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+   vec16u* lpvRing = (vec16u*)lvRing.pMem;
+
+   apu_close_cross( lpvOut0, lOut0.chunkSpan / 2,
+                    lpvIn0, lIn0.chunkSpan / 2,
+                    lIn0.chunkWidth, lIn0.chunkHeight,
+                    lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the gated opening kernel (3x3 square element, 8 bit mask)
+*
+*  ACTIVE comes from tile_activity_08u on the same mask. Opening and closing
+*  map a neighbourhood without any set pixel to zero, and tile_activity scans
+*  a border as wide as the 2 element dependency of this kernel, so an inactive
+*  tile is filled with zeros and skips both passes with an exact result.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void open_3x3_gated_08u(kernel_io_desc lIn0, kernel_io_desc lActive, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec08u*  lpvIn0   = (vec08u*)lIn0.pMem;
+   uint8_t* lpActive = (uint8_t*)lActive.pMem;
+   vec08u*  lpvOut0  = (vec08u*)lOut0.pMem;
+   vec08u*  lpvRing  = (vec08u*)lvRing.pMem;
+
+   if (lpActive[0] == 0)
+   {
+      apu_tile_fill( lpvOut0, lOut0.chunkSpan,
+                     lIn0.chunkWidth, lIn0.chunkHeight, 0 );
+      return;
+   }
+   apu_open_3x3( lpvOut0, lOut0.chunkSpan,
+                 lpvIn0, lIn0.chunkSpan,
+                 lIn0.chunkWidth, lIn0.chunkHeight,
+                 lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the gated closing kernel (3x3 square element, 8 bit mask)
+*  \see open_3x3_gated_08u
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void close_3x3_gated_08u(kernel_io_desc lIn0, kernel_io_desc lActive, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec08u*  lpvIn0   = (vec08u*)lIn0.pMem;
+   uint8_t* lpActive = (uint8_t*)lActive.pMem;
+   vec08u*  lpvOut0  = (vec08u*)lOut0.pMem;
+   vec08u*  lpvRing  = (vec08u*)lvRing.pMem;
+
+   if (lpActive[0] == 0)
+   {
+      apu_tile_fill( lpvOut0, lOut0.chunkSpan,
+                     lIn0.chunkWidth, lIn0.chunkHeight, 0 );
+      return;
+   }
+   apu_close_3x3( lpvOut0, lOut0.chunkSpan,
+                  lpvIn0, lIn0.chunkSpan,
+                  lIn0.chunkWidth, lIn0.chunkHeight,
+                  lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the gated opening kernel (3x3 square element, packed mask)
+*  \see open_3x3_gated_08u; ACTIVE comes from tile_activity_1u
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void open_3x3_gated_1u(kernel_io_desc lIn0, kernel_io_desc lActive, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec16u*  lpvIn0   = (vec16u*)lIn0.pMem;
+   uint8_t* lpActive = (uint8_t*)lActive.pMem;
+   vec16u*  lpvOut0  = (vec16u*)lOut0.pMem;
+   vec16u*  lpvRing  = (vec16u*)lvRing.pMem;
+
+   if (lpActive[0] == 0)
+   {
+      apu_tile_fill( lpvOut0, lOut0.chunkSpan / 2,
+                     lIn0.chunkWidth, lIn0.chunkHeight, 0 );
+      return;
+   }
+   apu_open_3x3( lpvOut0, lOut0.chunkSpan / 2,
+                 lpvIn0, lIn0.chunkSpan / 2,
+                 lIn0.chunkWidth, lIn0.chunkHeight,
+                 lpvRing );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the gated closing kernel (3x3 square element, packed mask)
+*  \see open_3x3_gated_1u
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void close_3x3_gated_1u(kernel_io_desc lIn0, kernel_io_desc lActive, kernel_io_desc lOut0, kernel_io_desc lvRing)
+{
+   vec16u*  lpvIn0   = (vec16u*)lIn0.pMem;
+   uint8_t* lpActive = (uint8_t*)lActive.pMem;
+   vec16u*  lpvOut0  = (vec16u*)lOut0.pMem;
+   vec16u*  lpvRing  = (vec16u*)lvRing.pMem;
+
+   if (lpActive[0] == 0)
+   {
+      apu_tile_fill( lpvOut0, lOut0.chunkSpan / 2,
+                     lIn0.chunkWidth, lIn0.chunkHeight, 0 );
+      return;
+   }
+   apu_close_3x3( lpvOut0, lOut0.chunkSpan / 2,
+                  lpvIn0, lIn0.chunkSpan / 2,
+                  lIn0.chunkWidth, lIn0.chunkHeight,
+                  lpvRing );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
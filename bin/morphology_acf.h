@@ -0,0 +1,102 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file morphology_acf.h
+*  @brief Kernel identifiers for the morphology kernels
+***********************************************************************************/
+
+#ifndef MORPHOLOGYACF_H
+#define MORPHOLOGYACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define OUTPUT_0                        "OUTPUT_0"
+#define ACTIVE                          "ACTIVE"
+
+/*! Widest strip (elements per CU) the row ring of the fused kernels holds; wider chunks run in strips */
+#define MORPHOLOGY_MAX_CHUNK_WIDTH      64
+
+/*! Elements of the row ring: three eroded / dilated rows with a 1 element border */
+#define MORPHOLOGY_RING_SIZE            (3 * (MORPHOLOGY_MAX_CHUNK_WIDTH + 2))
+
+#define ERODE_3x3_08u_K                 erode_3x3_08u
+#define ERODE_3x3_08u_KN                "erode_3x3_08u"
+
+#define ERODE_CROSS_08u_K               erode_cross_08u
+#define ERODE_CROSS_08u_KN              "erode_cross_08u"
+
+#define DILATE_3x3_08u_K                dilate_3x3_08u
+#define DILATE_3x3_08u_KN               "dilate_3x3_08u"
+
+#define DILATE_CROSS_08u_K              dilate_cross_08u
+#define DILATE_CROSS_08u_KN             "dilate_cross_08u"
+
+#define OPEN_3x3_08u_K                  open_3x3_08u
+#define OPEN_3x3_08u_KN                 "open_3x3_08u"
+
+#define OPEN_CROSS_08u_K                open_cross_08u
+#define OPEN_CROSS_08u_KN               "open_cross_08u"
+
+#define CLOSE_3x3_08u_K                 close_3x3_08u
+#define CLOSE_3x3_08u_KN                "close_3x3_08u"
+
+#define CLOSE_CROSS_08u_K               close_cross_08u
+#define CLOSE_CROSS_08u_KN              "close_cross_08u"
+
+#define ERODE_3x3_1u_K                  erode_3x3_1u
+#define ERODE_3x3_1u_KN                 "erode_3x3_1u"
+
+#define ERODE_CROSS_1u_K                erode_cross_1u
+#define ERODE_CROSS_1u_KN               "erode_cross_1u"
+
+#define DILATE_3x3_1u_K                 dilate_3x3_1u
+#define DILATE_3x3_1u_KN                "dilate_3x3_1u"
+
+#define DILATE_CROSS_1u_K               dilate_cross_1u
+#define DILATE_CROSS_1u_KN              "dilate_cross_1u"
+
+#define OPEN_3x3_1u_K                   open_3x3_1u
+#define OPEN_3x3_1u_KN                  "open_3x3_1u"
+
+#define OPEN_CROSS_1u_K                 open_cross_1u
+#define OPEN_CROSS_1u_KN                "open_cross_1u"
+
+#define CLOSE_3x3_1u_K                  close_3x3_1u
+#define CLOSE_3x3_1u_KN                 "close_3x3_1u"
+
+#define CLOSE_CROSS_1u_K                close_cross_1u
+#define CLOSE_CROSS_1u_KN               "close_cross_1u"
+
+#define OPEN_3x3_GATED_08u_K            open_3x3_gated_08u
+#define OPEN_3x3_GATED_08u_KN           "open_3x3_gated_08u"
+
+#define CLOSE_3x3_GATED_08u_K           close_3x3_gated_08u
+#define CLOSE_3x3_GATED_08u_KN          "close_3x3_gated_08u"
+
+#define OPEN_3x3_GATED_1u_K             open_3x3_gated_1u
+#define OPEN_3x3_GATED_1u_KN            "open_3x3_gated_1u"
+
+#define CLOSE_3x3_GATED_1u_K            close_3x3_gated_1u
+#define CLOSE_3x3_GATED_1u_KN           "close_3x3_gated_1u"
+
+#endif /* MORPHOLOGYACF_H */
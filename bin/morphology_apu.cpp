@@ -0,0 +1,326 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file morphology_apu.cpp
+*  @brief APU implementation of the morphology kernels
+*
+*  Every operation is written as a row function taking the three source rows
+*  it reads, so that the fused kernels can run the second operation on rows
+*  held in the CMEM ring exactly like the single ones run on the tile.
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "morphology_apu.h"
+#include "morphology_acf.h"
+
+struct MorphMin
+{
+   vec16u operator()(vec16u a, vec16u b) const { return vselect(b, a, vsgt(a, b)); }
+};
+
+struct MorphMax
+{
+   vec16u operator()(vec16u a, vec16u b) const { return vselect(a, b, vsgt(a, b)); }
+};
+
+struct MorphAnd
+{
+   vec16u operator()(vec16u a, vec16u b) const { return a & b; }
+};
+
+struct MorphOr
+{
+   vec16u operator()(vec16u a, vec16u b) const { return a | b; }
+};
+
+static inline vec16u morph_ld(const vec08u* p, int x)
+{
+   return __builtin_convertvector(p[x], vec16u);
+}
+
+/*!*********************************************************************************
+*  \brief One output row, columns [x0, x1), of an 8 bit erosion / dilation
+***********************************************************************************/
+template<typename OP, bool CROSS>
+static void morph_row(vec08u* dst,
+                      const vec08u* up, const vec08u* mid, const vec08u* dn,
+                      int x0, int x1)
+{
+   OP lOp;
+
+   if (CROSS)
+   {
+      for (int x = x0; x < x1; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lV = lOp(lOp(morph_ld(up, x), morph_ld(mid, x)), morph_ld(dn, x));
+         dst[x] = __builtin_convertvector(lOp(lOp(lV, morph_ld(mid, x - 1)), morph_ld(mid, x + 1)), vec08u);
+      }
+      return;
+   }
+
+   vec16u lA = lOp(lOp(morph_ld(up, x0 - 1), morph_ld(mid, x0 - 1)), morph_ld(dn, x0 - 1));
+   vec16u lB = lOp(lOp(morph_ld(up, x0), morph_ld(mid, x0)), morph_ld(dn, x0));
+
+   for (int x = x0; x < x1; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+   {
+      vec16u lC = lOp(lOp(morph_ld(up, x + 1), morph_ld(mid, x + 1)), morph_ld(dn, x + 1));
+      dst[x] = __builtin_convertvector(lOp(lOp(lA, lB), lC), vec08u);
+      lA = lB;
+      lB = lC;
+   }
+}
+
+/*!*********************************************************************************
+*  \brief One output row, words [x0, x1), of a packed mask erosion / dilation
+***********************************************************************************/
+template<typename OP, bool CROSS>
+static void morph_row(vec16u* dst,
+                      const vec16u* up, const vec16u* mid, const vec16u* dn,
+                      int x0, int x1)
+{
+   OP     lOp;
+   vec16u lOne = 1;
+   vec16u lTop = 15;
+
+   if (CROSS)
+   {
+      for (int x = x0; x < x1; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lV     = lOp(lOp(up[x], mid[x]), dn[x]);
+         vec16u lLeft  = (mid[x] << lOne) | (mid[x - 1] >> lTop);
+         vec16u lRight = (mid[x] >> lOne) | (mid[x + 1] << lTop);
+         dst[x] = lOp(lOp(lV, lLeft), lRight);
+      }
+      return;
+   }
+
+   vec16u lA = lOp(lOp(up[x0 - 1], mid[x0 - 1]), dn[x0 - 1]);
+   vec16u lB = lOp(lOp(up[x0], mid[x0]), dn[x0]);
+
+   for (int x = x0; x < x1; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+   {
+      vec16u lC     = lOp(lOp(up[x + 1], mid[x + 1]), dn[x + 1]);
+      vec16u lLeft  = (lB << lOne) | (lA >> lTop);
+      vec16u lRight = (lB >> lOne) | (lC << lTop);
+      dst[x] = lOp(lOp(lB, lLeft), lRight);
+      lA = lB;
+      lB = lC;
+   }
+}
+
+template<typename OP, bool CROSS, typename T>
+static void morph_tile(T* dst, int dstr,
+                       const T* src, int sstr,
+                       int bw, int bh)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      morph_row<OP, CROSS>(dst, src - sstr, src, src + sstr, 0, bw);
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+/*!*********************************************************************************
+*  \brief OP2 applied to OP1 of a strip of at most MORPHOLOGY_MAX_CHUNK_WIDTH
+*         columns, the OP1 rows kept in a three row ring
+*
+*  OP1 row r (r = -1 .. bh) covers the columns -1 .. bw so that OP2 finds its
+*  border; ring rows are addressed from column -1.
+***********************************************************************************/
+template<typename OP1, typename OP2, bool CROSS, typename T>
+static void morph_fused_strip(T* dst, int dstr,
+                              const T* src, int sstr,
+                              int bw, int bh,
+                              T* lpRing)
+{
+   int lRingStride = bw + 2;
+   T*  lpUp  = lpRing + 1;
+   T*  lpMid = lpUp + lRingStride;
+   T*  lpDn  = lpMid + lRingStride;
+
+   morph_row<OP1, CROSS>(lpUp, src - 2 * sstr, src - sstr, src, -1, bw + 1);
+   morph_row<OP1, CROSS>(lpMid, src - sstr, src, src + sstr, -1, bw + 1);
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      morph_row<OP1, CROSS>(lpDn, src, src + sstr, src + 2 * sstr, -1, bw + 1);
+      morph_row<OP2, CROSS>(dst, lpUp, lpMid, lpDn, 0, bw);
+
+      T* lpFree = lpUp;
+      lpUp  = lpMid;
+      lpMid = lpDn;
+      lpDn  = lpFree;
+
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+/*!*********************************************************************************
+*  \brief OP2 applied to OP1 of the tile
+*
+*  The ring only holds rows of MORPHOLOGY_MAX_CHUNK_WIDTH columns, so wider
+*  chunks are processed in strips rather than overrunning it; the strips read
+*  their side borders from the neighbouring columns of the tile.
+***********************************************************************************/
+template<typename OP1, typename OP2, bool CROSS, typename T>
+static void morph_fused_tile(T* dst, int dstr,
+                             const T* src, int sstr,
+                             int bw, int bh,
+                             T* lpRing)
+{
+   for (int x = 0; x < bw; x += MORPHOLOGY_MAX_CHUNK_WIDTH) chess_loop_range(1,)
+   {
+      int lWidth = bw - x;
+      if (lWidth > MORPHOLOGY_MAX_CHUNK_WIDTH)
+      {
+         lWidth = MORPHOLOGY_MAX_CHUNK_WIDTH;
+      }
+      morph_fused_strip<OP1, OP2, CROSS>(dst + x, dstr, src + x, sstr, lWidth, bh, lpRing);
+   }
+}
+
+void apu_erode_3x3(vec08u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh)
+{
+   morph_tile<MorphMin, false>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_erode_cross(vec08u* dst, int dstr,
+                     const vec08u* src, int sstr,
+                     int bw, int bh)
+{
+   morph_tile<MorphMin, true>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_dilate_3x3(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh)
+{
+   morph_tile<MorphMax, false>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_dilate_cross(vec08u* dst, int dstr,
+                      const vec08u* src, int sstr,
+                      int bw, int bh)
+{
+   morph_tile<MorphMax, true>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_open_3x3(vec08u* dst, int dstr,
+                  const vec08u* src, int sstr,
+                  int bw, int bh,
+                  vec08u* lpRing)
+{
+   morph_fused_tile<MorphMin, MorphMax, false>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+void apu_open_cross(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh,
+                    vec08u* lpRing)
+{
+   morph_fused_tile<MorphMin, MorphMax, true>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+void apu_close_3x3(vec08u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh,
+                   vec08u* lpRing)
+{
+   morph_fused_tile<MorphMax, MorphMin, false>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+void apu_close_cross(vec08u* dst, int dstr,
+                     const vec08u* src, int sstr,
+                     int bw, int bh,
+                     vec08u* lpRing)
+{
+   morph_fused_tile<MorphMax, MorphMin, true>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+void apu_erode_3x3(vec16u* dst, int dstr,
+                   const vec16u* src, int sstr,
+                   int bw, int bh)
+{
+   morph_tile<MorphAnd, false>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_erode_cross(vec16u* dst, int dstr,
+                     const vec16u* src, int sstr,
+                     int bw, int bh)
+{
+   morph_tile<MorphAnd, true>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_dilate_3x3(vec16u* dst, int dstr,
+                    const vec16u* src, int sstr,
+                    int bw, int bh)
+{
+   morph_tile<MorphOr, false>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_dilate_cross(vec16u* dst, int dstr,
+                      const vec16u* src, int sstr,
+                      int bw, int bh)
+{
+   morph_tile<MorphOr, true>(dst, dstr, src, sstr, bw, bh);
+}
+
+void apu_open_3x3(vec16u* dst, int dstr,
+                  const vec16u* src, int sstr,
+                  int bw, int bh,
+                  vec16u* lpRing)
+{
+   morph_fused_tile<MorphAnd, MorphOr, false>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+void apu_open_cross(vec16u* dst, int dstr,
+                    const vec16u* src, int sstr,
+                    int bw, int bh,
+                    vec16u* lpRing)
+{
+   morph_fused_tile<MorphAnd, MorphOr, true>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+void apu_close_3x3(vec16u* dst, int dstr,
+                   const vec16u* src, int sstr,
+                   int bw, int bh,
+                   vec16u* lpRing)
+{
+   morph_fused_tile<MorphOr, MorphAnd, false>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+void apu_close_cross(vec16u* dst, int dstr,
+                     const vec16u* src, int sstr,
+                     int bw, int bh,
+                     vec16u* lpRing)
+{
+   morph_fused_tile<MorphOr, MorphAnd, true>(dst, dstr, src, sstr, bw, bh, lpRing);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
@@ -0,0 +1,131 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file morphology_apu.h
+*  @brief APU implementation of the morphology kernels
+***********************************************************************************/
+
+#ifndef APUMORPHOLOGYIMPL_H
+#define APUMORPHOLOGYIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Greyscale erosion / dilation (min / max over the structuring element)
+*
+*  The square element is separable: the vertical min / max of every column is
+*  computed once and reused by the three outputs that see it. src must have a
+*  border of 1 pixel. On binary 0 / 255 masks these are the binary operations.
+*
+*  \param dst   output tile
+*  \param dstr  output stride in vec08u elements
+*  \param src   input tile
+*  \param sstr  input stride in vec08u elements
+*  \param bw    chunk width
+*  \param bh    chunk height
+***********************************************************************************/
+void apu_erode_3x3(vec08u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh);
+void apu_erode_cross(vec08u* dst, int dstr,
+                     const vec08u* src, int sstr,
+                     int bw, int bh);
+void apu_dilate_3x3(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh);
+void apu_dilate_cross(vec08u* dst, int dstr,
+                      const vec08u* src, int sstr,
+                      int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Opening (erosion, then dilation) and closing (dilation, then erosion)
+*
+*  The intermediate rows never leave CMEM: they are produced one row ahead into
+*  lpRing, a ring of three rows of bw + 2 elements, and consumed from there by
+*  the second operation. src must have a border of 2 pixels.
+*
+*  \param lpRing scratch of at least 3 * (bw + 2) elements
+***********************************************************************************/
+void apu_open_3x3(vec08u* dst, int dstr,
+                  const vec08u* src, int sstr,
+                  int bw, int bh,
+                  vec08u* lpRing);
+void apu_open_cross(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh,
+                    vec08u* lpRing);
+void apu_close_3x3(vec08u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh,
+                   vec08u* lpRing);
+void apu_close_cross(vec08u* dst, int dstr,
+                     const vec08u* src, int sstr,
+                     int bw, int bh,
+                     vec08u* lpRing);
+
+/*!*********************************************************************************
+*  \brief Erosion / dilation of a packed mask (see binary_mask_apu.h)
+*
+*  AND / OR of the shifted words: the left and right neighbours of the 16 pixels
+*  of a word are the word shifted by one bit, with the bit crossing the word
+*  boundary taken from the adjacent word. src must have a border of 1 word.
+*
+*  \param dstr  output stride in vec16u elements
+*  \param sstr  input stride in vec16u elements
+*  \param bw    chunk width in 16 bit words
+***********************************************************************************/
+void apu_erode_3x3(vec16u* dst, int dstr,
+                   const vec16u* src, int sstr,
+                   int bw, int bh);
+void apu_erode_cross(vec16u* dst, int dstr,
+                     const vec16u* src, int sstr,
+                     int bw, int bh);
+void apu_dilate_3x3(vec16u* dst, int dstr,
+                    const vec16u* src, int sstr,
+                    int bw, int bh);
+void apu_dilate_cross(vec16u* dst, int dstr,
+                      const vec16u* src, int sstr,
+                      int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Opening / closing of a packed mask, intermediate rows kept in lpRing
+***********************************************************************************/
+void apu_open_3x3(vec16u* dst, int dstr,
+                  const vec16u* src, int sstr,
+                  int bw, int bh,
+                  vec16u* lpRing);
+void apu_open_cross(vec16u* dst, int dstr,
+                    const vec16u* src, int sstr,
+                    int bw, int bh,
+                    vec16u* lpRing);
+void apu_close_3x3(vec16u* dst, int dstr,
+                   const vec16u* src, int sstr,
+                   int bw, int bh,
+                   vec16u* lpRing);
+void apu_close_cross(vec16u* dst, int dstr,
+                     const vec16u* src, int sstr,
+                     int bw, int bh,
+                     vec16u* lpRing);
+
+#endif /* APUMORPHOLOGYIMPL_H */
@@ -0,0 +1,169 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file ragged_tile_acf.cpp
+* \addtogroup apexcv-ragged_tile
+* \addtogroup ragged_tile
+* \ingroup ragged_tile
+* @{
+* \brief ragged tile support (frames not a multiple of the CU array width)
+*/
+
+/*!*********************************************************************************
+*  @file ragged_tile_acf.cpp
+*  @brief ACF metadata and wrapper functions for the ragged tile kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "ragged_tile_acf.h"
+#include "inplace_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the ragged fill kernel (unsigned 8 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(RAGGED_FILL_08u_K)
+(
+   RAGGED_FILL_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(WIDTH),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the ragged fill kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(RAGGED_FILL_16s_K)
+(
+   RAGGED_FILL_16s_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(WIDTH),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief Ports of the ragged fill kernels that may be bound to one buffer
+***********************************************************************************/
+const ACF_INPLACE_PORT_PAIR gRaggedTileInplacePorts[] =
+{
+   { RAGGED_FILL_08u_KN, 0, 2 },
+   { RAGGED_FILL_16s_KN, 0, 2 },
+};
+const int gRaggedTileInplacePortsCount = sizeof(gRaggedTileInplacePorts) / sizeof(gRaggedTileInplacePorts[0]);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "ragged_tile_acf.h"
+#include "ragged_tile_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the ragged fill kernel (unsigned 8 bit)
+*
+*  WIDTH[0] is the frame width in pixels (0: no ragged columns), WIDTH[1] the
+*  value written to the columns beyond it.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void ragged_fill_08u(kernel_io_desc lIn0, kernel_io_desc lWidth, kernel_io_desc lOut0)
+{
+   vec08u*   lpvIn0  = (vec08u*)lIn0.pMem;
+   uint16_t* lpWidth = (uint16_t*)lWidth.pMem;
+   vec08u*   lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_ragged_fill( lpvOut0, lOut0.chunkSpan,
+                    lpvIn0, lIn0.chunkSpan,
+                    lIn0.chunkWidth, lIn0.chunkHeight,
+                    apu_ragged_valid_columns(lpWidth[0], lIn0.chunkWidth),
+                    (uint8_t)lpWidth[1] );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the ragged fill kernel (signed 16 bit)
+*  \see ragged_fill_08u
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void ragged_fill_16s(kernel_io_desc lIn0, kernel_io_desc lWidth, kernel_io_desc lOut0)
+{
+   vec16s*   lpvIn0  = (vec16s*)lIn0.pMem;
+   uint16_t* lpWidth = (uint16_t*)lWidth.pMem;
+   vec16s*   lpvOut0 = (vec16s*)lOut0.pMem;
+
+   apu_ragged_fill( lpvOut0, lOut0.chunkSpan / 2,
+                    lpvIn0, lIn0.chunkSpan / 2,
+                    lIn0.chunkWidth, lIn0.chunkHeight,
+                    apu_ragged_valid_columns(lpWidth[0], lIn0.chunkWidth),
+                    (int16_t)lpWidth[1] );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
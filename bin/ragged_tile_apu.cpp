@@ -0,0 +1,91 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file ragged_tile_apu.cpp
+*  @brief APU implementation of the ragged tile helpers
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "ragged_tile_apu.h"
+
+vec16s apu_cu_index()
+{
+   return vscan_cu_index();
+}
+
+vec16s apu_ragged_valid_columns(int lWidth, int bw)
+{
+   vec16s lBw = (vec16s)bw;
+
+   if (lWidth <= 0)
+   {
+      return lBw;
+   }
+
+   vec16s lValid = (vec16s)lWidth - apu_cu_index() * lBw;
+   vec16s lZero  = 0;
+
+   lValid = vselect(lZero, lValid, vsgt(lZero, lValid));
+   lValid = vselect(lBw, lValid, vsgt(lValid, lBw));
+   return lValid;
+}
+
+void apu_ragged_fill(vec08u* dst, int dstr,
+                     const vec08u* src, int sstr,
+                     int bw, int bh,
+                     vec16s lvValid, uint8_t lFill)
+{
+   vec08u lvFill = (vec08u)lFill;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = __builtin_convertvector(vselect(src[x], lvFill, vsgt(lvValid, (vec16s)x)), vec08u);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_ragged_fill(vec16s* dst, int dstr,
+                     const vec16s* src, int sstr,
+                     int bw, int bh,
+                     vec16s lvValid, int16_t lFill)
+{
+   vec16s lvFill = (vec16s)lFill;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = vselect(src[x], lvFill, vsgt(lvValid, (vec16s)x));
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
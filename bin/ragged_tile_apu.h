@@ -0,0 +1,84 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file ragged_tile_apu.h
+*  @brief APU helpers for frames whose width is not a multiple of the CU array width
+*
+*  A tile row is split over the CUs, CU i holding the columns [i * bw, (i + 1) * bw).
+*  When the frame width W is not a multiple of the chunk width the last active
+*  CU holds a partial chunk and the CUs after it hold no valid columns at all.
+*  Element-wise kernels simply compute garbage there, which is never read back;
+*  kernels that reduce over columns or CUs must mask those lanes, which is what
+*  the helpers below are for.
+***********************************************************************************/
+
+#ifndef APURAGGEDTILEIMPL_H
+#define APURAGGEDTILEIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Index of each CU in the CU array (0 for the leftmost CU)
+***********************************************************************************/
+vec16s apu_cu_index();
+
+/*!*********************************************************************************
+*  \brief Number of valid columns of the chunk held by each CU
+*
+*  \param lWidth  frame width in pixels; 0 means the tile row is fully valid
+*  \param bw      chunk width in pixels
+*  \return        min(max(lWidth - i * bw, 0), bw) on CU i
+***********************************************************************************/
+vec16s apu_ragged_valid_columns(int lWidth, int bw);
+
+/*!*********************************************************************************
+*  \brief Replaces the columns beyond the frame width with lFill
+*
+*  Meant to run once after a DMA of a ragged tile, so that kernels which are not
+*  ragged aware (min/max, histograms, filters reading across the frame edge)
+*  see a defined value in the unused columns. dst may equal src.
+*
+*  \param dst      output tile
+*  \param dstr     output stride in elements
+*  \param src      input tile
+*  \param sstr     input stride in elements
+*  \param bw       chunk width
+*  \param bh       chunk height
+*  \param lvValid  valid columns per CU, see apu_ragged_valid_columns()
+*  \param lFill    value of the invalid columns
+***********************************************************************************/
+void apu_ragged_fill(vec08u* dst, int dstr,
+                     const vec08u* src, int sstr,
+                     int bw, int bh,
+                     vec16s lvValid, uint8_t lFill);
+
+/*!*********************************************************************************
+*  \brief Signed 16 bit version of apu_ragged_fill()
+***********************************************************************************/
+void apu_ragged_fill(vec16s* dst, int dstr,
+                     const vec16s* src, int sstr,
+                     int bw, int bh,
+                     vec16s lvValid, int16_t lFill);
+
+#endif /* APURAGGEDTILEIMPL_H */
@@ -0,0 +1,238 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file rank_filter_acf.cpp
+* \addtogroup apexcv-rank_filter
+* \addtogroup rank_filter
+* \ingroup rank_filter
+* @{
+* \brief median and rank filters
+*/
+
+/*!*********************************************************************************
+*  @file rank_filter_acf.cpp
+*  @brief ACF metadata and wrapper functions for the median and rank filter kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "rank_filter_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 3x3 median filter kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(MEDIAN_3x3_08u_K)
+(
+   MEDIAN_3x3_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 5x5 median filter kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(MEDIAN_5x5_08u_K)
+(
+   MEDIAN_5x5_08u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 3x3 rank filter kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(RANK_3x3_08u_K)
+(
+   RANK_3x3_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(1,1,1,1),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(RANK),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the 5x5 rank filter kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(RANK_5x5_08u_K)
+(
+   RANK_5x5_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(2,2,2,2),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(RANK),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "rank_filter_acf.h"
+#include "rank_filter_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 3x3 median filter kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void median_3x3_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_median_3x3( lpvOut0, lOut0.chunkSpan,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 5x5 median filter kernel
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void median_5x5_08u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec08u* lpvOut0 = (vec08u*)lOut0.pMem;
+
+   apu_median_5x5( lpvOut0, lOut0.chunkSpan,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 3x3 rank filter kernel
+*
+*  RANK[0] selects the output: 0 is the minimum, 4 the median and 8 the maximum
+*  of the window; larger values are clamped to 8.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void rank_3x3_08u(kernel_io_desc lIn0, kernel_io_desc lRank, kernel_io_desc lOut0)
+{
+   vec08u*  lpvIn0  = (vec08u*)lIn0.pMem;
+   uint8_t* lpRank  = (uint8_t*)lRank.pMem;
+   vec08u*  lpvOut0 = (vec08u*)lOut0.pMem;
+   int      lK      = (lpRank[0] > 8) ? 8 : lpRank[0];
+
+   apu_rank_3x3( lpvOut0, lOut0.chunkSpan,
+                 lpvIn0, lIn0.chunkSpan,
+                 lIn0.chunkWidth, lIn0.chunkHeight,
+                 lK );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the 5x5 rank filter kernel
+*
+*  RANK[0] selects the output: 0 is the minimum, 12 the median and 24 the
+*  maximum of the window; larger values are clamped to 24.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void rank_5x5_08u(kernel_io_desc lIn0, kernel_io_desc lRank, kernel_io_desc lOut0)
+{
+   vec08u*  lpvIn0  = (vec08u*)lIn0.pMem;
+   uint8_t* lpRank  = (uint8_t*)lRank.pMem;
+   vec08u*  lpvOut0 = (vec08u*)lOut0.pMem;
+   int      lK      = (lpRank[0] > 24) ? 24 : lpRank[0];
+
+   apu_rank_5x5( lpvOut0, lOut0.chunkSpan,
+                 lpvIn0, lIn0.chunkSpan,
+                 lIn0.chunkWidth, lIn0.chunkHeight,
+                 lK );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
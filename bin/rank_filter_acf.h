@@ -0,0 +1,48 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rank_filter_acf.h
+*  @brief Kernel identifiers for the median and rank filter kernels
+***********************************************************************************/
+
+#ifndef RANKFILTERACF_H
+#define RANKFILTERACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define OUTPUT_0                        "OUTPUT_0"
+#define RANK                            "RANK"
+
+#define MEDIAN_3x3_08u_K                median_3x3_08u
+#define MEDIAN_3x3_08u_KN               "median_3x3_08u"
+
+#define MEDIAN_5x5_08u_K                median_5x5_08u
+#define MEDIAN_5x5_08u_KN               "median_5x5_08u"
+
+#define RANK_3x3_08u_K                  rank_3x3_08u
+#define RANK_3x3_08u_KN                 "rank_3x3_08u"
+
+#define RANK_5x5_08u_K                  rank_5x5_08u
+#define RANK_5x5_08u_KN                 "rank_5x5_08u"
+
+#endif /* RANKFILTERACF_H */
@@ -0,0 +1,206 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rank_filter_apu.cpp
+*  @brief APU implementation of the median and rank filter kernels
+*
+*  Vertical neighbours are read through the stride, horizontal ones from the
+*  border columns ACF places around each chunk (spatial dependency), so no
+*  cross-CU moves are needed. All sorting is done in 16 bit lanes.
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "rank_filter_apu.h"
+
+/*! Batcher odd-even merge sort network for 9 keys */
+static const uint8_t gRankNet9[28][2] =
+{
+   { 0, 1}, { 2, 3}, { 4, 5}, { 6, 7}, { 0, 2}, { 1, 3}, { 4, 6}, { 5, 7},
+   { 1, 2}, { 5, 6}, { 0, 4}, { 1, 5}, { 2, 6}, { 3, 7}, { 2, 4}, { 3, 5},
+   { 1, 2}, { 3, 4}, { 5, 6}, { 0, 8}, { 4, 8}, { 2, 4}, { 3, 5}, { 6, 8},
+   { 1, 2}, { 3, 4}, { 5, 6}, { 7, 8}
+};
+
+/*! Batcher odd-even merge sort network for 25 keys (32 key network, pruned) */
+static const uint8_t gRankNet25[140][2] =
+{
+   { 0, 1}, { 2, 3}, { 4, 5}, { 6, 7}, { 8, 9}, {10,11}, {12,13}, {14,15},
+   {16,17}, {18,19}, {20,21}, {22,23}, { 0, 2}, { 1, 3}, { 4, 6}, { 5, 7},
+   { 8,10}, { 9,11}, {12,14}, {13,15}, {16,18}, {17,19}, {20,22}, {21,23},
+   { 1, 2}, { 5, 6}, { 9,10}, {13,14}, {17,18}, {21,22}, { 0, 4}, { 1, 5},
+   { 2, 6}, { 3, 7}, { 8,12}, { 9,13}, {10,14}, {11,15}, {16,20}, {17,21},
+   {18,22}, {19,23}, { 2, 4}, { 3, 5}, {10,12}, {11,13}, {18,20}, {19,21},
+   { 1, 2}, { 3, 4}, { 5, 6}, { 9,10}, {11,12}, {13,14}, {17,18}, {19,20},
+   {21,22}, { 0, 8}, { 1, 9}, { 2,10}, { 3,11}, { 4,12}, { 5,13}, { 6,14},
+   { 7,15}, {16,24}, { 4, 8}, { 5, 9}, { 6,10}, { 7,11}, {20,24}, { 2, 4},
+   { 3, 5}, { 6, 8}, { 7, 9}, {10,12}, {11,13}, {18,20}, {19,21}, {22,24},
+   { 1, 2}, { 3, 4}, { 5, 6}, { 7, 8}, { 9,10}, {11,12}, {13,14}, {17,18},
+   {19,20}, {21,22}, {23,24}, { 0,16}, { 1,17}, { 2,18}, { 3,19}, { 4,20},
+   { 5,21}, { 6,22}, { 7,23}, { 8,24}, { 8,16}, { 9,17}, {10,18}, {11,19},
+   {12,20}, {13,21}, {14,22}, {15,23}, { 4, 8}, { 5, 9}, { 6,10}, { 7,11},
+   {12,16}, {13,17}, {14,18}, {15,19}, {20,24}, { 2, 4}, { 3, 5}, { 6, 8},
+   { 7, 9}, {10,12}, {11,13}, {14,16}, {15,17}, {18,20}, {19,21}, {22,24},
+   { 1, 2}, { 3, 4}, { 5, 6}, { 7, 8}, { 9,10}, {11,12}, {13,14}, {15,16},
+   {17,18}, {19,20}, {21,22}, {23,24}
+};
+
+/*! Median selection network for 25 keys: only key 12 is valid afterwards */
+static const uint8_t gRankMedian25[99][2] =
+{
+   { 0, 1}, { 3, 4}, { 2, 4}, { 2, 3}, { 6, 7}, { 5, 7}, { 5, 6}, { 9,10},
+   { 8,10}, { 8, 9}, {12,13}, {11,13}, {11,12}, {15,16}, {14,16}, {14,15},
+   {18,19}, {17,19}, {17,18}, {21,22}, {20,22}, {20,21}, {23,24}, { 2, 5},
+   { 3, 6}, { 0, 6}, { 0, 3}, { 4, 7}, { 1, 7}, { 1, 4}, {11,14}, { 8,14},
+   { 8,11}, {12,15}, { 9,15}, { 9,12}, {13,16}, {10,16}, {10,13}, {20,23},
+   {17,23}, {17,20}, {21,24}, {18,24}, {18,21}, {19,22}, { 8,17}, { 9,18},
+   { 0,18}, { 0, 9}, {10,19}, { 1,19}, { 1,10}, {11,20}, { 2,20}, { 2,11},
+   {12,21}, { 3,21}, { 3,12}, {13,22}, { 4,22}, { 4,13}, {14,23}, { 5,23},
+   { 5,14}, {15,24}, { 6,24}, { 6,15}, { 7,16}, { 7,19}, {13,21}, {15,23},
+   { 7,13}, { 7,15}, { 1, 9}, { 3,11}, { 5,17}, {11,17}, { 9,17}, { 4,10},
+   { 6,12}, { 7,14}, { 4, 6}, { 4, 7}, {12,14}, {10,14}, { 6, 7}, {10,12},
+   { 6,10}, { 6,17}, {12,17}, { 7,17}, { 7,10}, {12,18}, { 7,12}, {10,18},
+   {12,20}, {10,20}, {10,12}
+};
+
+static inline vec16u rank_min(vec16u a, vec16u b)
+{
+   return vselect(b, a, vsgt(a, b));
+}
+
+static inline vec16u rank_max(vec16u a, vec16u b)
+{
+   return vselect(a, b, vsgt(a, b));
+}
+
+static inline vec16u rank_med3(vec16u a, vec16u b, vec16u c)
+{
+   return rank_max(rank_min(a, b), rank_min(rank_max(a, b), c));
+}
+
+/*!*********************************************************************************
+*  \brief Rank filter over an NxN window ordered by the L comparator network NET
+*
+*  The network is a template argument, so after the full unroll every
+*  compare-exchange addresses fixed elements of lV and the window stays in
+*  registers.
+***********************************************************************************/
+template<int N, int L, const uint8_t (&NET)[L][2]>
+static void rank_tile(vec08u* dst, int dstr,
+                      const vec08u* src, int sstr,
+                      int bw, int bh,
+                      int lRank)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lV[N * N];
+         apex_unroll_loop_full
+         for (int dy = 0; dy < N; ++dy)
+         {
+            apex_unroll_loop_full
+            for (int dx = 0; dx < N; ++dx)
+            {
+               lV[dy * N + dx] = __builtin_convertvector(src[(dy - N / 2) * sstr + x + dx - N / 2], vec16u);
+            }
+         }
+
+         apex_unroll_loop_full
+         for (int i = 0; i < L; ++i)
+         {
+            vsort_cmpx(&lV[NET[i][0]], &lV[NET[i][1]]);
+         }
+         dst[x] = __builtin_convertvector(lV[lRank], vec08u);
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_median_3x3(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      const vec08u* lpR0 = src - sstr;
+      const vec08u* lpR1 = src;
+      const vec08u* lpR2 = src + sstr;
+
+      // sorted columns x - 1 (A) and x (B); column x + 1 (C) is sorted in the loop
+      vec16u lLoA = __builtin_convertvector(lpR0[-1], vec16u);
+      vec16u lMiA = __builtin_convertvector(lpR1[-1], vec16u);
+      vec16u lHiA = __builtin_convertvector(lpR2[-1], vec16u);
+      vsort_cmpx(&lLoA, &lMiA); vsort_cmpx(&lMiA, &lHiA); vsort_cmpx(&lLoA, &lMiA);
+
+      vec16u lLoB = __builtin_convertvector(lpR0[0], vec16u);
+      vec16u lMiB = __builtin_convertvector(lpR1[0], vec16u);
+      vec16u lHiB = __builtin_convertvector(lpR2[0], vec16u);
+      vsort_cmpx(&lLoB, &lMiB); vsort_cmpx(&lMiB, &lHiB); vsort_cmpx(&lLoB, &lMiB);
+
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lLoC = __builtin_convertvector(lpR0[x + 1], vec16u);
+         vec16u lMiC = __builtin_convertvector(lpR1[x + 1], vec16u);
+         vec16u lHiC = __builtin_convertvector(lpR2[x + 1], vec16u);
+         vsort_cmpx(&lLoC, &lMiC); vsort_cmpx(&lMiC, &lHiC); vsort_cmpx(&lLoC, &lMiC);
+
+         vec16u lLo = rank_max(rank_max(lLoA, lLoB), lLoC);
+         vec16u lMi = rank_med3(lMiA, lMiB, lMiC);
+         vec16u lHi = rank_min(rank_min(lHiA, lHiB), lHiC);
+         dst[x] = __builtin_convertvector(rank_med3(lLo, lMi, lHi), vec08u);
+
+         lLoA = lLoB; lMiA = lMiB; lHiA = lHiB;
+         lLoB = lLoC; lMiB = lMiC; lHiB = lHiC;
+      }
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_median_5x5(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh)
+{
+   rank_tile<5, 99, gRankMedian25>(dst, dstr, src, sstr, bw, bh, 12);
+}
+
+void apu_rank_3x3(vec08u* dst, int dstr,
+                  const vec08u* src, int sstr,
+                  int bw, int bh,
+                  int lRank)
+{
+   rank_tile<3, 28, gRankNet9>(dst, dstr, src, sstr, bw, bh, lRank);
+}
+
+void apu_rank_5x5(vec08u* dst, int dstr,
+                  const vec08u* src, int sstr,
+                  int bw, int bh,
+                  int lRank)
+{
+   rank_tile<5, 140, gRankNet25>(dst, dstr, src, sstr, bw, bh, lRank);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
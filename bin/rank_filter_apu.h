@@ -0,0 +1,87 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rank_filter_apu.h
+*  @brief APU implementation of the median and rank filter kernels
+***********************************************************************************/
+
+#ifndef APURANKFILTERIMPL_H
+#define APURANKFILTERIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief 3x3 median filter
+*
+*  Each column triple is sorted once (3 compare-exchanges) and reused by the three
+*  outputs that see it; the median is then med3(max of the minima, med3 of the
+*  middles, min of the maxima), about 13 min/max operations per pixel in all.
+*  src must have a border of 1 pixel.
+*
+*  \param dst   output tile
+*  \param dstr  output stride in vec08u elements
+*  \param src   input tile
+*  \param sstr  input stride in vec08u elements
+*  \param bw    chunk width
+*  \param bh    chunk height
+***********************************************************************************/
+void apu_median_3x3(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief 5x5 median filter (rank 12 of apu_rank_5x5())
+*
+*  Runs a median selection network of 99 compare-exchanges instead of the full
+*  140 of the sort: comparators that cannot move the middle key are left out.
+*  src must have a border of 2 pixels.
+***********************************************************************************/
+void apu_median_5x5(vec08u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief 3x3 rank filter: the lRank-th smallest value of the window
+*
+*  The window is sorted by a Batcher odd-even merge network (28 compare-exchanges).
+*  lRank 0 is the minimum, 4 the median, 8 the maximum. src must have a border of
+*  1 pixel.
+***********************************************************************************/
+void apu_rank_3x3(vec08u* dst, int dstr,
+                  const vec08u* src, int sstr,
+                  int bw, int bh,
+                  int lRank);
+
+/*!*********************************************************************************
+*  \brief 5x5 rank filter: the lRank-th smallest value of the window
+*
+*  Batcher network of 140 compare-exchanges; lRank 0..24, 12 is the median.
+*  src must have a border of 2 pixels.
+***********************************************************************************/
+void apu_rank_5x5(vec08u* dst, int dstr,
+                  const vec08u* src, int sstr,
+                  int bw, int bh,
+                  int lRank);
+
+#endif /* APURANKFILTERIMPL_H */
@@ -0,0 +1,125 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file rle_acf.cpp
+* \addtogroup apexcv-rle
+* \addtogroup rle
+* \ingroup rle
+* @{
+* \brief run-length encoding of masks
+*/
+
+/*!*********************************************************************************
+*  @file rle_acf.cpp
+*  @brief ACF metadata and wrapper function for the run-length encoding kernel
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "rle_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the run-length encoding kernel (8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(RLE_ENCODE_08u_K)
+(
+   RLE_ENCODE_08u_KN,
+   4,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(PARAMS),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(STREAM),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(RLE_MAX_BYTES, 1)),
+   __port(__index(3),
+          __identifier(INFO),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(3, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "rle_acf.h"
+#include "rle_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the run-length encoding kernel (8 bit mask)
+*
+*  Encodes the frame row by row into STREAM, in the format of rle_acf.h, for
+*  decoding on the host with rle_decode() (rle_host.h). PARAMS[0] is the run
+*  width, RLE_RUN_BITS_8 or RLE_RUN_BITS_16 (any other value selects 16).
+*  INFO[0] is the number of bytes used, INFO[1] the number of rows encoded and
+*  INFO[2] is set when the stream overflowed; rows after it are dropped.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void rle_encode_08u(kernel_io_desc lIn0, kernel_io_desc lParams, kernel_io_desc lStream, kernel_io_desc lInfo)
+{
+   vec08u*   lpvIn0   = (vec08u*)lIn0.pMem;
+   uint8_t*  lpParams = (uint8_t*)lParams.pMem;
+   uint8_t*  lpStream = (uint8_t*)lStream.pMem;
+   uint32_t* lpInfo   = (uint32_t*)lInfo.pMem;
+   int       lBits    = (lpParams[0] == RLE_RUN_BITS_8) ? RLE_RUN_BITS_8 : RLE_RUN_BITS_16;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      lpInfo[0] = 0;
+      lpInfo[1] = 0;
+      lpInfo[2] = 0;
+   }
+   apu_rle_encode( lpStream, RLE_MAX_BYTES, lpInfo,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight,
+                   lBits );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
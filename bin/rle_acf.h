@@ -0,0 +1,62 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rle_acf.h
+*  @brief Kernel identifiers and stream format of the run-length encoding kernel
+*
+*  The stream holds one record per mask row, in row order:
+*  - a 16 bit little endian header; bit 15 (RLE_ROW_RAW) clear: the low 15 bits
+*    are the number of runs that follow, set: the low 15 bits are the number of
+*    raw bytes that follow;
+*  - runs: alternating runs of zero and non zero pixels, starting with zeros
+*    (possibly an empty run), covering the whole row. Each run length takes
+*    RLE_RUN_BITS_8 or RLE_RUN_BITS_16 bits, little endian. With 8 bit runs a
+*    longer run is split into 255, 0, 255, 0, ..., rest (the 0 is an empty run
+*    of the other value);
+*  - raw bytes: the row as packed bits, bit i of byte k is pixel 8k + i. Used
+*    when the runs would not be smaller (high entropy rows).
+***********************************************************************************/
+
+#ifndef RLEACF_H
+#define RLEACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define PARAMS                          "PARAMS"
+#define STREAM                          "STREAM"
+#define INFO                            "INFO"
+
+/*! Bytes the encoded stream port can hold */
+#define RLE_MAX_BYTES                   16384
+
+/*! Header flag of a raw (packed bit) row */
+#define RLE_ROW_RAW                     0x8000
+
+/*! Run length widths */
+#define RLE_RUN_BITS_8                  8
+#define RLE_RUN_BITS_16                 16
+
+#define RLE_ENCODE_08u_K                rle_encode_08u
+#define RLE_ENCODE_08u_KN               "rle_encode_08u"
+
+#endif /* RLEACF_H */
@@ -0,0 +1,188 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rle_apu.cpp
+*  @brief APU implementation of the run-length encoding kernel
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "rle_apu.h"
+#include "rle_acf.h"
+
+/*!*********************************************************************************
+*  \brief Writes one run at lpOut[*lpPos], lEnd excluded; false if it does not fit
+***********************************************************************************/
+static bool rle_put_run(uint8_t* lpOut, int* lpPos, int lEnd, int* lpRuns,
+                        int lLength, int lRunBits)
+{
+   int lPos = *lpPos;
+
+   if (lRunBits == RLE_RUN_BITS_16)
+   {
+      if (lPos + 2 > lEnd)
+      {
+         return false;
+      }
+      lpOut[lPos]     = (uint8_t)lLength;
+      lpOut[lPos + 1] = (uint8_t)(lLength >> 8);
+      *lpPos   = lPos + 2;
+      *lpRuns += 1;
+      return true;
+   }
+
+   while (lLength > 255)
+   {
+      if (lPos + 2 > lEnd)
+      {
+         return false;
+      }
+      lpOut[lPos]     = 255;
+      lpOut[lPos + 1] = 0;
+      lPos    += 2;
+      lLength -= 255;
+      *lpRuns += 2;
+   }
+   if (lPos + 1 > lEnd)
+   {
+      return false;
+   }
+   lpOut[lPos] = (uint8_t)lLength;
+   *lpPos   = lPos + 1;
+   *lpRuns += 1;
+   return true;
+}
+
+/*!*********************************************************************************
+*  \brief Run record of one row; false if it is not smaller than lEnd allows
+***********************************************************************************/
+static bool rle_encode_runs(uint8_t* lpOut, int* lpPos, int lEnd, int* lpRuns,
+                            const vec08u* src, vec16u lvTrans,
+                            int lCUs, int bw, int lRunBits)
+{
+   int lPrev  = 0;
+   int lStart = 0;
+
+   for (int cu = 0; cu < lCUs; ++cu)
+   {
+      if (vget(lvTrans, cu) == 0)
+      {
+         continue; // same value as the pixel before the chunk throughout
+      }
+      for (int x = 0; x < bw; ++x)
+      {
+         int lValue = (vget(src[x], cu) != 0) ? 1 : 0;
+         if (lValue != lPrev)
+         {
+            int lPix = cu * bw + x;
+            if (!rle_put_run(lpOut, lpPos, lEnd, lpRuns, lPix - lStart, lRunBits))
+            {
+               return false;
+            }
+            lStart = lPix;
+            lPrev  = lValue;
+         }
+      }
+   }
+   return rle_put_run(lpOut, lpPos, lEnd, lpRuns, lCUs * bw - lStart, lRunBits);
+}
+
+void apu_rle_encode(uint8_t* lpOut, int lCapacity, uint32_t* lpInfo,
+                    const vec08u* src, int sstr,
+                    int bw, int bh, int lRunBits)
+{
+   int    lCUs   = apuGetNumberOfCUs();
+   int    lRaw   = (lCUs * bw + 7) / 8;
+   vec16u lZero  = 0;
+   vec16u lOne   = 1;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      if (lpInfo[2] != 0)
+      {
+         return;
+      }
+
+      // transitions per CU chunk, the first pixel compared with the last one of the CU to the left
+      vec16u lPrev  = vmr(vselect(lOne, lZero, vsne(__builtin_convertvector(src[bw - 1], vec16u), lZero)), lZero);
+      vec16u lTrans = 0;
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec16u lBin = vselect(lOne, lZero, vsne(__builtin_convertvector(src[x], vec16u), lZero));
+         lTrans = lTrans + vselect(lOne, lZero, vsne(lBin, lPrev));
+         lPrev  = lBin;
+      }
+
+      int lRow  = lpInfo[0];
+      int lPos  = lRow + 2;
+      int lRuns = 0;
+      int lHeader;
+
+      // runs are kept only if they beat the raw row
+      int lEnd = lPos + lRaw - 1;
+      if (lEnd > lCapacity)
+      {
+         lEnd = lCapacity;
+      }
+      if (rle_encode_runs(lpOut, &lPos, lEnd, &lRuns, src, lTrans, lCUs, bw, lRunBits))
+      {
+         lHeader = lRuns;
+      }
+      else
+      {
+         lPos = lRow + 2;
+         if (lPos + lRaw > lCapacity)
+         {
+            lpInfo[2] = 1;
+            return;
+         }
+         for (int i = 0; i < lRaw; ++i)
+         {
+            lpOut[lPos + i] = 0;
+         }
+         for (int cu = 0; cu < lCUs; ++cu)
+         {
+            for (int x = 0; x < bw; ++x)
+            {
+               int lPix = cu * bw + x;
+               if (vget(src[x], cu) != 0)
+               {
+                  lpOut[lPos + (lPix >> 3)] |= (uint8_t)(1 << (lPix & 7));
+               }
+            }
+         }
+         lPos   += lRaw;
+         lHeader = RLE_ROW_RAW | lRaw;
+      }
+
+      lpOut[lRow]     = (uint8_t)lHeader;
+      lpOut[lRow + 1] = (uint8_t)(lHeader >> 8);
+      lpInfo[0] = lPos;
+      lpInfo[1] += 1;
+
+      src += sstr;
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
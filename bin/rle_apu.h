@@ -0,0 +1,58 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rle_apu.h
+*  @brief APU implementation of the run-length encoding kernel
+***********************************************************************************/
+
+#ifndef APURLEIMPL_H
+#define APURLEIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Appends the run-length records of the rows of a tile to a stream
+*
+*  The stream format is described in rle_acf.h. The transitions of each row are
+*  found on the vector unit: every pixel is compared with its left neighbour,
+*  the neighbour of the first pixel of a chunk being moved in from the CU to
+*  the left with vmr. Only CU chunks containing transitions are then walked on
+*  the scalar side to write the runs. Pixels are zero / non zero; the row width
+*  is the number of CUs times bw.
+*
+*  \param lpOut      encoded stream
+*  \param lCapacity  bytes lpOut can hold
+*  \param lpInfo     [0] bytes used, [1] rows encoded, [2] set once a row did not
+*                    fit; all updated. No row is written after an overflow.
+*  \param src        input tile
+*  \param sstr       stride in vec08u elements
+*  \param bw         chunk width
+*  \param bh         chunk height
+*  \param lRunBits   RLE_RUN_BITS_8 or RLE_RUN_BITS_16
+***********************************************************************************/
+void apu_rle_encode(uint8_t* lpOut, int lCapacity, uint32_t* lpInfo,
+                    const vec08u* src, int sstr,
+                    int bw, int bh, int lRunBits);
+
+#endif /* APURLEIMPL_H */
@@ -0,0 +1,105 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rle_host.cpp
+*  @brief Host side decoder of the stream written by the rle_encode_08u kernel
+***********************************************************************************/
+
+#include "rle_host.h"
+#include "rle_acf.h"
+#include <string.h>
+
+/*!*********************************************************************************
+*  \brief Decodes the runs of one row; false if they do not cover exactly lWidth
+***********************************************************************************/
+static bool rle_decode_runs(const uint8_t* lpSrc, int lRuns, int lRunBits,
+                            uint8_t* lpRow, int lWidth,
+                            uint8_t lOff, uint8_t lOn)
+{
+   int lX = 0;
+
+   for (int i = 0; i < lRuns; ++i)
+   {
+      int lLength = lpSrc[0];
+      if (lRunBits == RLE_RUN_BITS_16)
+      {
+         lLength |= lpSrc[1] << 8;
+         lpSrc   += 2;
+      }
+      else
+      {
+         lpSrc += 1;
+      }
+      if (lX + lLength > lWidth)
+      {
+         return false;
+      }
+      memset(lpRow + lX, (i & 1) ? lOn : lOff, lLength);
+      lX += lLength;
+   }
+   return lX == lWidth;
+}
+
+int rle_decode(const uint8_t* lpStream, int lBytes, int lRunBits,
+               uint8_t* lpDst, int lStride, int lWidth, int lRows,
+               uint8_t lOff, uint8_t lOn)
+{
+   int lRunBytes = (lRunBits == RLE_RUN_BITS_8) ? 1 : 2;
+   int lPos      = 0;
+
+   for (int y = 0; y < lRows; ++y)
+   {
+      if (lPos + 2 > lBytes)
+      {
+         return -1;
+      }
+      int      lHeader = lpStream[lPos] | (lpStream[lPos + 1] << 8);
+      int      lCount  = lHeader & ~RLE_ROW_RAW;
+      uint8_t* lpRow   = lpDst + y * lStride;
+      lPos += 2;
+
+      if (lHeader & RLE_ROW_RAW)
+      {
+         if (lPos + lCount > lBytes || lCount * 8 < lWidth)
+         {
+            return -1;
+         }
+         for (int x = 0; x < lWidth; ++x)
+         {
+            lpRow[x] = ((lpStream[lPos + (x >> 3)] >> (x & 7)) & 1) ? lOn : lOff;
+         }
+         lPos += lCount;
+      }
+      else
+      {
+         if (lPos + lCount * lRunBytes > lBytes ||
+             !rle_decode_runs(lpStream + lPos, lCount, lRunBits, lpRow, lWidth, lOff, lOn))
+         {
+            return -1;
+         }
+         lPos += lCount * lRunBytes;
+      }
+   }
+   return lRows;
+}
@@ -0,0 +1,52 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file rle_host.h
+*  @brief Host side decoder of the stream written by the rle_encode_08u kernel
+***********************************************************************************/
+
+#ifndef RLEHOST_H
+#define RLEHOST_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Decodes a run-length stream (format in rle_acf.h) into an 8 bit mask
+*
+*  \param lpStream  encoded stream (STREAM port of rle_encode_08u)
+*  \param lBytes    bytes used (INFO[0])
+*  \param lRunBits  run width the stream was encoded with
+*  \param lpDst     output mask, lRows rows of lWidth pixels
+*  \param lStride   output stride in bytes
+*  \param lWidth    row width in pixels (CU count times chunk width)
+*  \param lRows     rows to decode (INFO[1])
+*  \param lOff      value of zero pixels
+*  \param lOn       value of non zero pixels
+*  \return          number of rows decoded, or -1 if the stream is malformed
+***********************************************************************************/
+int rle_decode(const uint8_t* lpStream, int lBytes, int lRunBits,
+               uint8_t* lpDst, int lStride, int lWidth, int lRows,
+               uint8_t lOff, uint8_t lOn);
+
+#endif /* RLEHOST_H */
@@ -0,0 +1,156 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file scan_acf.cpp
+* \addtogroup apexcv-scan
+* \addtogroup scan
+* \ingroup scan
+* @{
+* \brief prefix sums
+*/
+
+/*!*********************************************************************************
+*  @file scan_acf.cpp
+*  @brief ACF metadata and wrapper functions for the prefix sum kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "scan_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the row prefix sum kernel (unsigned 8 bit in, 32 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(SCAN_ROWS_08u_32u_K)
+(
+   SCAN_ROWS_08u_32u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the frame prefix sum kernel (unsigned 8 bit in, 32 bit out)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(SCAN_FRAME_08u_32u_K)
+(
+   SCAN_FRAME_08u_32u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(CARRY),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "scan_acf.h"
+#include "scan_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the row prefix sum kernel
+*
+*  Each output is the sum of the input pixels to its left in the same row,
+*  itself included.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void scan_rows_08u_32u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec08u* lpvIn0  = (vec08u*)lIn0.pMem;
+   vec32u* lpvOut0 = (vec32u*)lOut0.pMem;
+
+   apu_scan_rows( lpvOut0, lOut0.chunkSpan / 4,
+                  lpvIn0, lIn0.chunkSpan,
+                  lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the frame prefix sum kernel
+*
+*  Each output is the sum of all input pixels before it in raster order, itself
+*  included; the exclusive sum is the output minus the input. CARRY holds the
+*  running total between tiles (cleared on the first tile) and the frame total
+*  at the end, so tiles must be processed top to bottom. Used for 0 / 1 inputs
+*  it gives the output slot of every set pixel, as needed for stream compaction.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void scan_frame_08u_32u(kernel_io_desc lIn0, kernel_io_desc lOut0, kernel_io_desc lCarry)
+{
+   vec08u*   lpvIn0  = (vec08u*)lIn0.pMem;
+   vec32u*   lpvOut0 = (vec32u*)lOut0.pMem;
+   uint32_t* lpCarry = (uint32_t*)lCarry.pMem;
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      *lpCarry = 0;
+   }
+   apu_scan_frame( lpvOut0, lOut0.chunkSpan / 4,
+                   lpvIn0, lIn0.chunkSpan,
+                   lIn0.chunkWidth, lIn0.chunkHeight,
+                   lpCarry );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
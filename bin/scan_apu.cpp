@@ -0,0 +1,94 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file scan_apu.cpp
+*  @brief APU implementation of the prefix sum kernels
+*
+*  Same two pass row scheme as the integral image: prefix inside the CU chunk,
+*  then the totals of the CUs to the left added through vscan_excl().
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "scan_apu.h"
+
+/*!*********************************************************************************
+*  \brief In-CU prefix of one row; returns the total of each CU chunk
+***********************************************************************************/
+static vec32u scan_chunk_row(vec32u* dst, const vec08u* src, int bw)
+{
+   vec32u lRow = 0;
+
+   for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+   {
+      vacl(lRow, __builtin_convertvector(src[x], vec16u));
+      dst[x] = lRow;
+   }
+   return lRow;
+}
+
+static void scan_add_offset(vec32u* dst, int bw, vec32u lOffset)
+{
+   for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+   {
+      dst[x] = dst[x] + lOffset;
+   }
+}
+
+void apu_scan_rows(vec32u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh)
+{
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      vec32u lTotal = scan_chunk_row(dst, src, bw);
+      scan_add_offset(dst, bw, vscan_excl(lTotal));
+
+      src += sstr;
+      dst += dstr;
+   }
+}
+
+void apu_scan_frame(vec32u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh,
+                    uint32_t* lpCarry)
+{
+   int      lLast  = apuGetNumberOfCUs() - 1;
+   uint32_t lCarry = *lpCarry;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      vec32u lTotal = scan_chunk_row(dst, src, bw);
+      vec32u lIncl  = vscan_incl(lTotal);
+      scan_add_offset(dst, bw, lIncl - lTotal + (vec32u)lCarry);
+      lCarry += vget(lIncl, lLast);
+
+      src += sstr;
+      dst += dstr;
+   }
+   *lpCarry = lCarry;
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
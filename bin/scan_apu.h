@@ -0,0 +1,62 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file scan_apu.h
+*  @brief APU implementation of the prefix sum kernels
+***********************************************************************************/
+
+#ifndef APUSCANIMPL_H
+#define APUSCANIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Inclusive prefix sum of every row of a tile, left to right over all CUs
+*
+*  \param dst   output tile (32 bit)
+*  \param dstr  output stride in vec32u elements
+*  \param src   input tile
+*  \param sstr  input stride in vec08u elements
+*  \param bw    chunk width
+*  \param bh    chunk height
+***********************************************************************************/
+void apu_scan_rows(vec32u* dst, int dstr,
+                   const vec08u* src, int sstr,
+                   int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Inclusive prefix sum of the frame in raster order
+*
+*  As apu_scan_rows(), with the sum of all previous rows added to each row.
+*  That sum is kept in *lpCarry, which the caller clears before the first tile
+*  and which holds the frame total after the last one.
+*
+*  \param lpCarry running total of the rows already processed
+***********************************************************************************/
+void apu_scan_frame(vec32u* dst, int dstr,
+                    const vec08u* src, int sstr,
+                    int bw, int bh,
+                    uint32_t* lpCarry);
+
+#endif /* APUSCANIMPL_H */
@@ -0,0 +1,149 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file sort_acf.cpp
+* \addtogroup apexcv-sort
+* \addtogroup sort
+* \ingroup sort
+* @{
+* \brief sorting networks
+*/
+
+/*!*********************************************************************************
+*  @file sort_acf.cpp
+*  @brief ACF metadata and wrapper functions for the sorting kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "sort_acf.h"
+#include "inplace_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the column sort kernel (signed 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(SORT_COLUMNS_16s_K)
+(
+   SORT_COLUMNS_16s_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16s),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the column sort kernel (unsigned 16 bit)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(SORT_COLUMNS_16u_K)
+(
+   SORT_COLUMNS_16u_KN,
+   2,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief Ports of the sorting kernels that may be bound to one buffer
+***********************************************************************************/
+const ACF_INPLACE_PORT_PAIR gSortInplacePorts[] =
+{
+   { SORT_COLUMNS_16s_KN, 0, 1 },
+   { SORT_COLUMNS_16u_KN, 0, 1 },
+};
+const int gSortInplacePortsCount = sizeof(gSortInplacePorts) / sizeof(gSortInplacePorts[0]);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "sort_acf.h"
+#include "sort_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the column sort kernel (signed 16 bit)
+*
+*  Sorts the keys of every column of the tile (chunkHeight keys each) in
+*  ascending order; rows are not mixed across tiles.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void sort_columns_16s(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec16s* lpvIn0  = (vec16s*)lIn0.pMem;
+   vec16s* lpvOut0 = (vec16s*)lOut0.pMem;
+
+   apu_sort_columns( lpvOut0, lOut0.chunkSpan / 2,
+                     lpvIn0, lIn0.chunkSpan / 2,
+                     lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the column sort kernel (unsigned 16 bit)
+*  \see sort_columns_16s
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void sort_columns_16u(kernel_io_desc lIn0, kernel_io_desc lOut0)
+{
+   vec16u* lpvIn0  = (vec16u*)lIn0.pMem;
+   vec16u* lpvOut0 = (vec16u*)lOut0.pMem;
+
+   apu_sort_columns( lpvOut0, lOut0.chunkSpan / 2,
+                     lpvIn0, lIn0.chunkSpan / 2,
+                     lIn0.chunkWidth, lIn0.chunkHeight );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
@@ -0,0 +1,99 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file sort_apu.cpp
+*  @brief APU implementation of the sorting kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "sort_apu.h"
+
+void apu_sort_columns(vec16s* dst, int dstr,
+                      const vec16s* src, int sstr,
+                      int bw, int bh)
+{
+   if (dst != src)
+   {
+      vec16s*       lpDst = dst;
+      const vec16s* lpSrc = src;
+      for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+      {
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            lpDst[x] = lpSrc[x];
+         }
+         lpSrc += sstr;
+         lpDst += dstr;
+      }
+   }
+
+   for (int lPass = 0; lPass < bh; ++lPass) chess_loop_range(1,)
+   {
+      for (int y = lPass & 1; y + 1 < bh; y += 2)
+      {
+         vec16s* lpA = dst + y * dstr;
+         vec16s* lpB = lpA + dstr;
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            vsort_cmpx(&lpA[x], &lpB[x]);
+         }
+      }
+   }
+}
+
+void apu_sort_columns(vec16u* dst, int dstr,
+                      const vec16u* src, int sstr,
+                      int bw, int bh)
+{
+   if (dst != src)
+   {
+      vec16u*       lpDst = dst;
+      const vec16u* lpSrc = src;
+      for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+      {
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            lpDst[x] = lpSrc[x];
+         }
+         lpSrc += sstr;
+         lpDst += dstr;
+      }
+   }
+
+   for (int lPass = 0; lPass < bh; ++lPass) chess_loop_range(1,)
+   {
+      for (int y = lPass & 1; y + 1 < bh; y += 2)
+      {
+         vec16u* lpA = dst + y * dstr;
+         vec16u* lpB = lpA + dstr;
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            vsort_cmpx(&lpA[x], &lpB[x]);
+         }
+      }
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
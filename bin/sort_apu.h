@@ -0,0 +1,55 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file sort_apu.h
+*  @brief APU implementation of the sorting kernels
+***********************************************************************************/
+
+#ifndef APUSORTIMPL_H
+#define APUSORTIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Sorts every column of a tile in ascending order, top to bottom
+*
+*  Odd-even transposition network over the bh rows: bh passes of vsort_cmpx()
+*  on alternating row pairs, i.e. bh * (bh - 1) / 2 compare-exchanges per
+*  column, all columns of a row pair in one pipelined loop. dst may equal src.
+*
+*  \param dst   output tile
+*  \param dstr  output stride in elements
+*  \param src   input tile
+*  \param sstr  input stride in elements
+*  \param bw    chunk width
+*  \param bh    chunk height (number of keys per column)
+***********************************************************************************/
+void apu_sort_columns(vec16s* dst, int dstr,
+                      const vec16s* src, int sstr,
+                      int bw, int bh);
+void apu_sort_columns(vec16u* dst, int dstr,
+                      const vec16u* src, int sstr,
+                      int bw, int bh);
+
+#endif /* APUSORTIMPL_H */
@@ -0,0 +1,150 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file temporal_stats_acf.cpp
+* \addtogroup apexcv-temporal_stats
+* \addtogroup temporal_stats
+* \ingroup temporal_stats
+* @{
+* \brief temporal statistics (running mean and variance)
+*/
+
+/*!*********************************************************************************
+*  @file temporal_stats_acf.cpp
+*  @brief ACF metadata and wrapper function for the temporal statistics kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "temporal_stats_acf.h"
+#include "inplace_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the running mean / variance kernel (unsigned 8 bit frame)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(RUNNING_STATS_08u_K)
+(
+   RUNNING_STATS_08u_KN,
+   6,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(INPUT_1),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(INPUT_2),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier(ALPHA),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(4),
+          __identifier(OUTPUT_0),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(5),
+          __identifier(OUTPUT_1),
+          __attributes(ACF_ATTR_VEC_OUT),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief Ports of the temporal statistics kernels that may be bound to one buffer
+*
+*  The model planes are meant to be updated in place: bind the mean and variance
+*  inputs and outputs to the same buffers and keep them across frames.
+***********************************************************************************/
+const ACF_INPLACE_PORT_PAIR gTemporalStatsInplacePorts[] =
+{
+   { RUNNING_STATS_08u_KN, 1, 4 },
+   { RUNNING_STATS_08u_KN, 2, 5 },
+};
+const int gTemporalStatsInplacePortsCount = sizeof(gTemporalStatsInplacePorts) / sizeof(gTemporalStatsInplacePorts[0]);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "temporal_stats_acf.h"
+#include "temporal_stats_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the running mean / variance kernel
+*
+*  Fuses accumulate_16s and accumulate_squared_16s and the host side variance:
+*  INPUT_1 / OUTPUT_0 carry the mean (Q8), INPUT_2 / OUTPUT_1 the variance (Q8),
+*  ALPHA is the forgetting factor in Q15. Pass RUNNING_STATS_ALPHA_ONE on the
+*  first frame to initialise the model.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void running_stats_08u(kernel_io_desc lIn0, kernel_io_desc lMean, kernel_io_desc lVar, kernel_io_desc lAlpha, kernel_io_desc lOutMean, kernel_io_desc lOutVar)
+{
+   vec08u*   lpvIn0     = (vec08u*)lIn0.pMem;
+   vec16u*   lpvMean    = (vec16u*)lMean.pMem;
+   vec32u*   lpvVar     = (vec32u*)lVar.pMem;
+   uint16_t* lpAlpha    = (uint16_t*)lAlpha.pMem;
+   vec16u*   lpvOutMean = (vec16u*)lOutMean.pMem;
+   vec32u*   lpvOutVar  = (vec32u*)lOutVar.pMem;
+
+   apu_running_stats( lpvOutMean, lOutMean.chunkSpan / 2,
+                      lpvOutVar, lOutVar.chunkSpan / 4,
+                      lpvIn0, lIn0.chunkSpan,
+                      lpvMean, lMean.chunkSpan / 2,
+                      lpvVar, lVar.chunkSpan / 4,
+                      lIn0.chunkWidth, lIn0.chunkHeight,
+                      lpAlpha[0] );
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
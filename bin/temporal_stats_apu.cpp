@@ -0,0 +1,97 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file temporal_stats_apu.cpp
+*  @brief APU implementation of the temporal statistics kernels
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "temporal_stats_apu.h"
+#include "temporal_stats_acf.h"
+
+void apu_running_stats(vec16u* dstMean, int dmstr,
+                       vec32u* dstVar, int dvstr,
+                       const vec08u* src, int sstr,
+                       const vec16u* srcMean, int smstr,
+                       const vec32u* srcVar, int svstr,
+                       int bw, int bh,
+                       uint16_t lAlpha)
+{
+   if (lAlpha >= RUNNING_STATS_ALPHA_ONE)
+   {
+      for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+      {
+         for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+         {
+            dstMean[x] = __builtin_convertvector(src[x], vec16u) << (vec16u)8;
+            dstVar[x]  = 0;
+         }
+         src     += sstr;
+         dstMean += dmstr;
+         dstVar  += dvstr;
+      }
+      return;
+   }
+
+   /* alpha and 1 - alpha in Q15; 1 - alpha is 1.0 (32768) for alpha == 0,
+      which still fits the unsigned 16 bit factor */
+   vec16s lA = (int16_t)lAlpha;
+   vec16u lB = (uint16_t)(RUNNING_STATS_ALPHA_ONE - lAlpha);
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         vec32s lMean = __builtin_convertvector(srcMean[x], vec32s);
+         vec32s lX    = __builtin_convertvector(src[x], vec32s) << (vec32s)8;
+         vec32s lD    = lX - lMean;
+
+         /* alpha * d in Q8; |d| < 2^16, so the Q15 product fits 32 bits */
+         vec32s lStep = vmul_16x32(lA, lD) >> (vec32s)15;
+
+         /* alpha * d^2 as (alpha * d) * d at Q4 resolution, one 16x16 product */
+         vec16s  lD4 = __builtin_convertvector(lD >> (vec32s)4, vec16s);
+         vec16s  lS4 = __builtin_convertvector(lStep >> (vec32s)4, vec16s);
+         vacc32s lSq;
+         vacc_clear(&lSq);
+         vacc_mac(&lSq, lS4, lD4);
+
+         vec32u lVar = srcVar[x] + (vec32u)vacc_get(lSq);
+
+         dstMean[x] = __builtin_convertvector(lMean + lStep, vec16u);
+
+         /* (1 - alpha) * var, var split at bit 15 so both products fit 32 bits */
+         dstVar[x]  = vmul_16x32(lB, lVar >> (vec32u)15)
+                    + (vmul_16x32(lB, lVar & (vec32u)0x7FFF) >> (vec32u)15);
+      }
+      src     += sstr;
+      srcMean += smstr;
+      srcVar  += svstr;
+      dstMean += dmstr;
+      dstVar  += dvstr;
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
@@ -0,0 +1,70 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file temporal_stats_apu.h
+*  @brief APU implementation of the temporal statistics kernels
+***********************************************************************************/
+
+#ifndef APUTEMPORALSTATSIMPL_H
+#define APUTEMPORALSTATSIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Exponentially weighted running mean and variance (Welford form)
+*
+*  Per pixel, with d = x - mean:
+*     mean += alpha * d
+*     var   = (1 - alpha) * (var + alpha * d^2)
+*
+*  mean is kept in Q8 (16 bit), var in Q8 (32 bit), so squares of 8 bit data
+*  never overflow. alpha * d^2 is formed as (alpha * d) * d at Q4 resolution,
+*  and all products are Q15 alpha times a 16 bit or 32 bit value
+*  (vmul_16x32), without a 32x32 multiply. The planes may be updated
+*  in place (dstMean == srcMean, dstVar == srcVar).
+*
+*  \param dstMean  updated mean plane
+*  \param dmstr    its stride in vec16u elements
+*  \param dstVar   updated variance plane
+*  \param dvstr    its stride in vec32u elements
+*  \param src      current frame
+*  \param sstr     frame stride in vec08u elements
+*  \param srcMean  mean plane
+*  \param smstr    its stride in vec16u elements
+*  \param srcVar   variance plane
+*  \param svstr    its stride in vec32u elements
+*  \param bw       chunk width
+*  \param bh       chunk height
+*  \param lAlpha   forgetting factor in Q15; RUNNING_STATS_ALPHA_ONE or more
+*                  resets the model to mean = x, var = 0
+***********************************************************************************/
+void apu_running_stats(vec16u* dstMean, int dmstr,
+                       vec32u* dstVar, int dvstr,
+                       const vec08u* src, int sstr,
+                       const vec16u* srcMean, int smstr,
+                       const vec32u* srcVar, int svstr,
+                       int bw, int bh,
+                       uint16_t lAlpha);
+
+#endif /* APUTEMPORALSTATSIMPL_H */
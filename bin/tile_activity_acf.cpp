@@ -0,0 +1,189 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file tile_activity_acf.cpp
+* \addtogroup apexcv-tile_activity
+* \addtogroup tile_activity
+* \ingroup tile_activity
+* @{
+* \brief tile activity (sparse tile skipping)
+*/
+
+/*!*********************************************************************************
+*  @file tile_activity_acf.cpp
+*  @brief ACF metadata and wrapper functions for the tile activity kernels
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "tile_activity_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the tile activity kernel (8 bit mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(TILE_ACTIVITY_08u_K)
+(
+   TILE_ACTIVITY_08u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(TILE_ACTIVITY_HALO,TILE_ACTIVITY_HALO,TILE_ACTIVITY_HALO,TILE_ACTIVITY_HALO),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(ACTIVE),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(ACTIVITY),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(TILE_ACTIVITY_WORDS + 1, 1))
+);
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the tile activity kernel (packed mask)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(TILE_ACTIVITY_1u_K)
+(
+   TILE_ACTIVITY_1u_KN,
+   3,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(TILE_ACTIVITY_HALO,TILE_ACTIVITY_HALO,TILE_ACTIVITY_HALO,TILE_ACTIVITY_HALO),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(ACTIVE),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(2),
+          __identifier(ACTIVITY),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(TILE_ACTIVITY_WORDS + 1, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "tile_activity_acf.h"
+#include "tile_activity_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief Stores the activity flag of the current tile and appends it to the bitmap
+***********************************************************************************/
+static void tile_activity_record(uint8_t* lpActive, uint16_t* lpBitmap, bool lAny)
+{
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      for (int i = 0; i <= TILE_ACTIVITY_WORDS; ++i)
+      {
+         lpBitmap[i] = 0;
+      }
+   }
+   *lpActive = lAny ? 1 : 0;
+
+   int lTile = lpBitmap[0];
+   if (lTile < TILE_ACTIVITY_MAX_TILES)
+   {
+      if (lAny)
+      {
+         lpBitmap[1 + (lTile >> 4)] |= (uint16_t)(1 << (lTile & 15));
+      }
+      lpBitmap[0] = (uint16_t)(lTile + 1);
+   }
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the tile activity kernel (8 bit mask)
+*
+*  ACTIVE is 1 when any pixel of the current tile, or of its border of
+*  TILE_ACTIVITY_HALO elements, is set. It drives the ACTIVE input of the gated
+*  morphology kernels later in the graph, which write zeros instead of running
+*  on an inactive tile; with the border included this is exact for every
+*  neighbourhood they read. ACTIVITY[0] counts the tiles of the frame and bit
+*  (i % 16) of ACTIVITY[1 + i / 16] is set for an active tile i; the host reads
+*  the bitmap to skip the inactive tiles of the kernels that follow. Tiles
+*  beyond TILE_ACTIVITY_MAX_TILES still set ACTIVE but are not recorded.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void tile_activity_08u(kernel_io_desc lIn0, kernel_io_desc lActive, kernel_io_desc lActivity)
+{
+   vec08u*   lpvIn0   = (vec08u*)lIn0.pMem;
+   uint8_t*  lpActive = (uint8_t*)lActive.pMem;
+   uint16_t* lpBitmap = (uint16_t*)lActivity.pMem;
+
+   int  lStr = lIn0.chunkSpan;
+   bool lAny = apu_tile_any( lpvIn0 - TILE_ACTIVITY_HALO * lStr - TILE_ACTIVITY_HALO, lStr,
+                             lIn0.chunkWidth + 2 * TILE_ACTIVITY_HALO,
+                             lIn0.chunkHeight + 2 * TILE_ACTIVITY_HALO );
+   tile_activity_record(lpActive, lpBitmap, lAny);
+}
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the tile activity kernel (packed mask)
+*  \see tile_activity_08u
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void tile_activity_1u(kernel_io_desc lIn0, kernel_io_desc lActive, kernel_io_desc lActivity)
+{
+   vec16u*   lpvIn0   = (vec16u*)lIn0.pMem;
+   uint8_t*  lpActive = (uint8_t*)lActive.pMem;
+   uint16_t* lpBitmap = (uint16_t*)lActivity.pMem;
+
+   int  lStr = lIn0.chunkSpan / 2;
+   bool lAny = apu_tile_any( lpvIn0 - TILE_ACTIVITY_HALO * lStr - TILE_ACTIVITY_HALO, lStr,
+                             lIn0.chunkWidth + 2 * TILE_ACTIVITY_HALO,
+                             lIn0.chunkHeight + 2 * TILE_ACTIVITY_HALO );
+   tile_activity_record(lpActive, lpBitmap, lAny);
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
@@ -0,0 +1,51 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file tile_activity_acf.h
+*  @brief Kernel identifiers for the tile activity kernels
+***********************************************************************************/
+
+#ifndef TILEACTIVITYACF_H
+#define TILEACTIVITYACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define ACTIVE                          "ACTIVE"
+#define ACTIVITY                        "ACTIVITY"
+
+/*! Border (elements) scanned around each tile, the widest neighbourhood of the gated kernels */
+#define TILE_ACTIVITY_HALO              2
+
+/*! Tiles per frame the activity bitmap can record */
+#define TILE_ACTIVITY_MAX_TILES         256
+
+/*! 16 bit words of the activity bitmap, not counting the tile count in front */
+#define TILE_ACTIVITY_WORDS             (TILE_ACTIVITY_MAX_TILES / 16)
+
+#define TILE_ACTIVITY_08u_K             tile_activity_08u
+#define TILE_ACTIVITY_08u_KN            "tile_activity_08u"
+
+#define TILE_ACTIVITY_1u_K              tile_activity_1u
+#define TILE_ACTIVITY_1u_KN             "tile_activity_1u"
+
+#endif /* TILEACTIVITYACF_H */
@@ -0,0 +1,95 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file tile_activity_apu.cpp
+*  @brief APU implementation of the tile activity kernels
+*
+*  The activity test ORs the tile on each CU and reduces the result over the CU
+*  array with vany, so a whole tile costs one pass over its data plus a single
+*  reduction.
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "tile_activity_apu.h"
+
+bool apu_tile_any(const vec08u* src, int sstr, int bw, int bh)
+{
+   vec08u lOr = 0;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         lOr = lOr | src[x];
+      }
+      src += sstr;
+   }
+   return vany(vsne(__builtin_convertvector(lOr, vec16u), (vec16u)0));
+}
+
+bool apu_tile_any(const vec16u* src, int sstr, int bw, int bh)
+{
+   vec16u lOr = 0;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         lOr = lOr | src[x];
+      }
+      src += sstr;
+   }
+   return vany(vsne(lOr, (vec16u)0));
+}
+
+void apu_tile_fill(vec08u* dst, int dstr, int bw, int bh, uint8_t lFill)
+{
+   vec08u lvFill = (vec08u)lFill;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = lvFill;
+      }
+      dst += dstr;
+   }
+}
+
+void apu_tile_fill(vec16u* dst, int dstr, int bw, int bh, uint16_t lFill)
+{
+   vec16u lvFill = (vec16u)lFill;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         dst[x] = lvFill;
+      }
+      dst += dstr;
+   }
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
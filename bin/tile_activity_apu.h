@@ -0,0 +1,59 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file tile_activity_apu.h
+*  @brief APU implementation of the tile activity kernels
+***********************************************************************************/
+
+#ifndef APUTILEACTIVITYIMPL_H
+#define APUTILEACTIVITYIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief True if any pixel of the tile, on any CU, is non zero
+*
+*  \param src   mask tile (8 bit per pixel)
+*  \param sstr  stride in vec08u elements
+*  \param bw    width scanned (the wrappers add the TILE_ACTIVITY_HALO border)
+*  \param bh    height scanned
+***********************************************************************************/
+bool apu_tile_any(const vec08u* src, int sstr, int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief True if any word of a packed mask tile (see binary_mask_apu.h) is non zero
+*
+*  \param bw    chunk width in 16 bit words
+***********************************************************************************/
+bool apu_tile_any(const vec16u* src, int sstr, int bw, int bh);
+
+/*!*********************************************************************************
+*  \brief Fills a tile with a constant
+*
+*  Used by the gated kernels in place of their regular pass on an inactive tile.
+***********************************************************************************/
+void apu_tile_fill(vec08u* dst, int dstr, int bw, int bh, uint8_t lFill);
+void apu_tile_fill(vec16u* dst, int dstr, int bw, int bh, uint16_t lFill);
+
+#endif /* APUTILEACTIVITYIMPL_H */
@@ -0,0 +1,180 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+ 
+/*!
+* \file tile_signature_acf.cpp
+* \addtogroup apexcv-tile_signature
+* \addtogroup tile_signature
+* \ingroup tile_signature
+* @{
+* \brief tile signature (incremental recomputation of static tiles)
+*/
+
+/*!*********************************************************************************
+*  @file tile_signature_acf.cpp
+*  @brief ACF metadata and wrapper function for the tile signature kernel
+***********************************************************************************/
+ 
+#ifdef APEX2_EMULATE
+#include "acf_kernel.hpp" // if using the ACF emulation library
+using namespace APEX2;
+#endif
+
+#ifdef ACF_KERNEL_METADATA
+
+#include "tile_signature_acf.h"
+
+/*!*********************************************************************************
+*  \brief ACF metadata for the tile signature kernel (unsigned 8 bit frame)
+*  \see UG-10267-03 ACF User Guide, Section 3.2.2
+***********************************************************************************/
+
+KERNEL_INFO kernelInfoConcat(TILE_SIGNATURE_08u_K)
+(
+   TILE_SIGNATURE_08u_KN,
+   7,
+   __port(__index(0),
+          __identifier(INPUT_0),
+          __attributes(ACF_ATTR_VEC_IN),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(1),
+          __identifier(PARAMS),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(2, 1)),
+   __port(__index(2),
+          __identifier(CHANGED),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d08u),
+          __e0_size(1, 1),
+          __ek_size(1, 1)),
+   __port(__index(3),
+          __identifier(CHANGED_MAP),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d16u),
+          __e0_size(1, 1),
+          __ek_size(TILE_SIGNATURE_WORDS + 1, 1)),
+   __port(__index(4),
+          __identifier(PREV_SIGNATURES),
+          __attributes(ACF_ATTR_SCL_IN_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(TILE_SIGNATURE_MAX_TILES + 1, 1)),
+   __port(__index(5),
+          __identifier(SIGNATURES),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(TILE_SIGNATURE_MAX_TILES + 1, 1)),
+   __port(__index(6),
+          __identifier(HITS),
+          __attributes(ACF_ATTR_SCL_OUT_STATIC_FIXED),
+          __spatial_dep(0,0,0,0),
+          __e0_data_type(d32u),
+          __e0_size(1, 1),
+          __ek_size(2, 1))
+);
+
+#endif //#ifdef ACF_KERNEL_METADATA
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "tile_signature_acf.h"
+#include "tile_signature_apu.h"
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief ACF wrapper function for the tile signature kernel (unsigned 8 bit frame)
+*
+*  Compares the signature of each tile with the one of the same tile in the
+*  previous frame. PARAMS[0] is the number of low bits ignored (clamped to 7),
+*  PARAMS[1] invalidates the cache (set it for the first frame of a sequence or
+*  after the graph changed).
+*
+*  CHANGED is 1 unless the tile is known unchanged. CHANGED_MAP has the layout of the ACTIVITY
+*  bitmap of tile_activity_08u: [0] tile count, bit (i % 16) of [1 + i / 16]
+*  set for a changed tile i, so the host can reuse the outputs of the other
+*  tiles. SIGNATURES holds [0] the number of tiles seen so far in the frame and
+*  [1 + i] the signature of tile i. The host keeps two such buffers and swaps
+*  them every frame, binding PREV_SIGNATURES to the SIGNATURES of the previous
+*  frame. Tiles beyond TILE_SIGNATURE_MAX_TILES are not cached and always count
+*  as changed.
+*  HITS[0] / HITS[1] count the unchanged / changed tiles of the current frame.
+*  \see UG-10267-03 ACF User Guide, Section 3.2.3
+***********************************************************************************/
+void tile_signature_08u(kernel_io_desc lIn0, kernel_io_desc lParams, kernel_io_desc lChanged, kernel_io_desc lChangedMap, kernel_io_desc lPrevSignatures, kernel_io_desc lSignatures, kernel_io_desc lHits)
+{
+   vec08u*   lpvIn0    = (vec08u*)lIn0.pMem;
+   uint8_t*  lpParams  = (uint8_t*)lParams.pMem;
+   uint8_t*  lpChanged = (uint8_t*)lChanged.pMem;
+   uint16_t* lpMap     = (uint16_t*)lChangedMap.pMem;
+   uint32_t* lpPrevSig = (uint32_t*)lPrevSignatures.pMem;
+   uint32_t* lpSig     = (uint32_t*)lSignatures.pMem;
+   uint32_t* lpHits    = (uint32_t*)lHits.pMem;
+   int       lShift    = (lpParams[0] > 7) ? 7 : lpParams[0];
+
+   if(ACF_RET_VAR(ACF_VAR_FIRST_TILE_FLAG))
+   {
+      for (int i = 0; i <= TILE_SIGNATURE_WORDS; ++i)
+      {
+         lpMap[i] = 0;
+      }
+      lpSig[0]  = 0;
+      lpHits[0] = 0;
+      lpHits[1] = 0;
+   }
+
+   uint32_t lSig       = apu_tile_signature( lpvIn0, lIn0.chunkSpan,
+                                             lIn0.chunkWidth, lIn0.chunkHeight,
+                                             lShift );
+   uint32_t lTile      = lpSig[0];
+   uint32_t lPrevCount = (lpParams[1] != 0) ? 0 : lpPrevSig[0];
+   bool     lIsChanged = true;
+
+   if (lTile < TILE_SIGNATURE_MAX_TILES)
+   {
+      lIsChanged = (lTile >= lPrevCount) || (lpPrevSig[1 + lTile] != lSig);
+      lpSig[1 + lTile] = lSig;
+      lpSig[0]         = lTile + 1;
+      if (lIsChanged)
+      {
+         lpMap[1 + (lTile >> 4)] |= (uint16_t)(1 << (lTile & 15));
+      }
+      lpMap[0] = (uint16_t)(lTile + 1);
+   }
+
+   *lpChanged = lIsChanged ? 1 : 0;
+   lpHits[lIsChanged ? 1 : 0] += 1;
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
+/*! @} */
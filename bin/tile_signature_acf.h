@@ -0,0 +1,49 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file tile_signature_acf.h
+*  @brief Kernel identifiers for the tile signature kernel
+***********************************************************************************/
+
+#ifndef TILESIGNATUREACF_H
+#define TILESIGNATUREACF_H
+
+#define INPUT_0                         "INPUT_0"
+#define PARAMS                          "PARAMS"
+#define CHANGED                         "CHANGED"
+#define CHANGED_MAP                     "CHANGED_MAP"
+#define PREV_SIGNATURES                 "PREV_SIGNATURES"
+#define SIGNATURES                      "SIGNATURES"
+#define HITS                            "HITS"
+
+/*! Tiles per frame whose signature is kept; the size of the signature cache */
+#define TILE_SIGNATURE_MAX_TILES        256
+
+/*! 16 bit words of the changed tile bitmap, not counting the tile count in front */
+#define TILE_SIGNATURE_WORDS            (TILE_SIGNATURE_MAX_TILES / 16)
+
+#define TILE_SIGNATURE_08u_K            tile_signature_08u
+#define TILE_SIGNATURE_08u_KN           "tile_signature_08u"
+
+#endif /* TILESIGNATUREACF_H */
@@ -0,0 +1,62 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file tile_signature_apu.cpp
+*  @brief APU implementation of the tile signature kernel
+***********************************************************************************/
+
+#ifdef ACF_KERNEL_IMPLEMENTATION
+
+#include "tile_signature_apu.h"
+
+uint32_t apu_tile_signature(const vec08u* src, int sstr, int bw, int bh, int lShift)
+{
+   vec16u lShiftV = (vec16u)lShift;
+   vec16u lH1     = 0x811C;
+   vec16u lH2     = 0x9DC5;
+
+   for (int y = 0; y < bh; ++y) chess_loop_range(1,)
+   {
+      for (int x = 0; x < bw; ++x) chess_loop_range(1,) chess_prepare_for_pipelining
+      {
+         lH1 = (lH1 ^ (__builtin_convertvector(src[x], vec16u) >> lShiftV)) * (vec16u)0x9E3B;
+         lH1 = lH1 ^ (lH1 >> 7);
+         lH2 = (lH2 + lH1) * (vec16u)0x6A09;
+      }
+      src += sstr;
+   }
+
+   int      lCUs = apuGetNumberOfCUs();
+   uint32_t lSig = 2166136261u;
+
+   for (int i = 0; i < lCUs; ++i) chess_loop_range(1,)
+   {
+      uint32_t lPair = ((uint32_t)vget(lH2, i) << 16) | (uint32_t)vget(lH1, i);
+      lSig = (lSig ^ lPair) * 16777619u;
+      lSig = lSig ^ (lSig >> 15);
+   }
+   return lSig;
+}
+
+#endif //#ifdef ACF_KERNEL_IMPLEMENTATION
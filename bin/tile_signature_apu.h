@@ -0,0 +1,56 @@
+/*****************************************************************************
+*
+* NXP Confidential Proprietary
+*
+* Copyright (c) 2013-2018 NXP
+* All Rights Reserved
+*
+*****************************************************************************
+*
+* THIS SOFTWARE IS PROVIDED BY NXP "AS IS" AND ANY EXPRESSED OR
+* IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL NXP OR ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+* INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+* THE POSSIBILITY OF SUCH DAMAGE.
+*
+****************************************************************************/
+
+/*!*********************************************************************************
+*  @file tile_signature_apu.h
+*  @brief APU implementation of the tile signature kernel
+***********************************************************************************/
+
+#ifndef APUTILESIGNATUREIMPL_H
+#define APUTILESIGNATUREIMPL_H
+
+#include <stdint.h>
+
+/*!*********************************************************************************
+*  \brief 32 bit signature of a whole tile (all CUs)
+*
+*  Each CU hashes its chunk in raster order into two 16 bit words: h1 takes
+*  every pixel through an xor, a multiply by an odd constant and an xor-shift,
+*  h2 accumulates h1 through a second multiply. Since each step multiplies the
+*  whole state, the contribution of a pixel depends on everything before it, so
+*  swapped or compensating pixels do not cancel as they do in plain sums; the
+*  xor-shift feeds the high bits of the product back into the low ones. The
+*  per-CU pairs are then folded into one word over the CU array (FNV-1a step
+*  followed by an xor-shift).
+*  Pixels are shifted right by lShift first, so that sensor noise in the low
+*  bits does not mark a static tile as changed.
+*
+*  \param src     input tile
+*  \param sstr    stride in vec08u elements
+*  \param bw      chunk width
+*  \param bh      chunk height
+*  \param lShift  low bits ignored (0..7, clamped by the wrapper)
+***********************************************************************************/
+uint32_t apu_tile_signature(const vec08u* src, int sstr, int bw, int bh, int lShift);
+
+#endif /* APUTILESIGNATUREIMPL_H */
@@ -33,6 +33,12 @@
 #include <apex/intrinsics.hpp>
 #include <apex/vec32-ctor.h>
 #include <apex/vif.h>
+#include <apex/vec08x2.h>
+#include <apex/vacc32.h>
+#include <apex/vmul32.h>
+#include <apex/vscan.h>
+#include <apex/vsort.h>
+#include <apex/vrand.h>
 #include <apex/runtime-info.h>
 
 
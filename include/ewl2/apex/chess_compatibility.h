@@ -9,13 +9,36 @@
 #ifndef _APEX_CHESS_COMPATIBILITY_H
 #define _APEX_CHESS_COMPATIBILITY_H
 
-#define chess_prepare_for_pipelining
+/*
+ * Chess loop hints. chess_loop_range(min, max) keeps its minimum trip count;
+ * the maximum has no clang equivalent. chess_unroll_loop and
+ * chess_prepare_for_pipelining follow the loop header, where clang accepts
+ * no loop pragma, so they are dropped: put apex_unroll_loop(n) or
+ * apex_unroll_loop_full in front of the loop instead (software pipelining is
+ * done by the packetizer on hardware loops without a hint). Define
+ * APEX_CHESS_REPORT_HINTS to get a compiler message for every dropped hint.
+ */
+#define __apex_chess_pragma(x) _Pragma(#x)
+#ifdef APEX_CHESS_REPORT_HINTS
+  #define __apex_chess_dropped(hint) \
+    __apex_chess_pragma(message("chess hint ignored: " hint))
+#else
+  #define __apex_chess_dropped(hint)
+#endif
+
+#define apex_unroll_loop(n) __apex_chess_pragma(unroll(n))
+#define apex_unroll_loop_full __apex_chess_pragma(unroll)
+
+#define chess_prepare_for_pipelining \
+  __apex_chess_dropped("chess_prepare_for_pipelining")
 #ifdef __OPENCL_C_VERSION__
-  #define chess_loop_range(min, max) __attribute__((apex_min_loop_count(1)))
-  #define chess_unroll_loop(n)
+  #define chess_loop_range(min, max) __attribute__((apex_min_loop_count(min)))
+  #define chess_unroll_loop(n) \
+    __apex_chess_dropped("chess_unroll_loop, use apex_unroll_loop before the loop")
 #else
-  #define chess_loop_range(...) __attribute__((apex_min_loop_count(1)))
-  #define chess_unroll_loop(...)
+  #define chess_loop_range(min, ...) __attribute__((apex_min_loop_count(min)))
+  #define chess_unroll_loop(...) \
+    __apex_chess_dropped("chess_unroll_loop, use apex_unroll_loop before the loop")
 #endif
 #define chess_storage(x)
 #define chess_copy(x) (x)
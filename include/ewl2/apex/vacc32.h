@@ -0,0 +1,257 @@
+/*===---------------------------------------------------------------------===//
+ * (C) Copyright Freescale 2016, All rights reserved.
+ * FREESCALE CONFIDENTIAL PROPRIETARY
+ * Contains Confidential Proprietary information of Freescale, Inc.
+ * Reverse engineering is prohibited.
+ * The copyright notice does not imply publication.
+ *===---------------------------------------------------------------------===*/
+
+
+/**
+ * @file
+ * Split 32-bit accumulators.
+ *
+ * The vec32 forms of vacl, vacm, vach and vmac unpack the accumulator into
+ * its 16-bit halves and pack it back on every call. A vacc32s / vacc32u keeps
+ * the halves apart, as the hardware does, for as long as the accumulation
+ * runs; the halves are packed once, when the result is read.
+ *
+ * The accumulate steps call the vacl / vacm builtins directly: the intrinsics
+ * of the same name are macros in C and reference overloads in C++, and OpenCL
+ * C has neither, whereas the builtins take pointers in every mode. vacc_mac
+ * is the four partial products of vmac.
+ */
+
+#ifndef _APEX_VACC32_H
+#define _APEX_VACC32_H
+
+#include <apex/scalar-types.h>
+#include <apex/vector-types.h>
+#include <apex/intr-func-quals.h>
+
+/**
+ * @addtogroup vaccInst Accumulator Intrinsics
+ * @brief 32-bit accumulators kept as a pair of 16-bit registers
+ * @{
+ */
+
+/** Signed 32-bit accumulator */
+typedef struct
+{
+  vec16s hi;
+  vec16u lo;
+} vacc32s;
+
+/** Unsigned 32-bit accumulator */
+typedef struct
+{
+  vec16u hi;
+  vec16u lo;
+} vacc32u;
+
+/**
+ * Clear an accumulator
+ * @param acc The accumulator
+ */
+__APEX_INT_F_QUALS void vacc_clear(vacc32s* restrict acc)
+{
+  acc->hi = 0;
+  acc->lo = 0;
+}
+
+/**
+ * Clear an accumulator
+ * @param acc The accumulator
+ */
+__APEX_INT_F_QUALS void vacc_clear(vacc32u* restrict acc)
+{
+  acc->hi = 0;
+  acc->lo = 0;
+}
+
+/**
+ * Load an accumulator from a 32-bit vector
+ * @param acc The accumulator
+ * @param v The initial value
+ */
+__APEX_INT_F_QUALS void vacc_set(vacc32s* restrict acc, vec32s v)
+{
+  acc->hi = __builtin_apex_vec32_get_hi(v);
+  acc->lo = (vec16u)__builtin_apex_vec32_get_lo(v);
+}
+
+/**
+ * Load an accumulator from a 32-bit vector
+ * @param acc The accumulator
+ * @param v The initial value
+ */
+__APEX_INT_F_QUALS void vacc_set(vacc32u* restrict acc, vec32u v)
+{
+  vec32s t = (vec32s)v;
+  acc->hi = (vec16u)__builtin_apex_vec32_get_hi(t);
+  acc->lo = (vec16u)__builtin_apex_vec32_get_lo(t);
+}
+
+/**
+ * Read an accumulator as a 32-bit vector
+ * @param acc The accumulator
+ * @return hi:lo
+ */
+__APEX_INT_F_QUALS vec32s vacc_get(vacc32s acc)
+{
+  return __builtin_apex_vec32_pack((vec16s)acc.lo, acc.hi);
+}
+
+/**
+ * Read an accumulator as a 32-bit vector
+ * @param acc The accumulator
+ * @return hi:lo
+ */
+__APEX_INT_F_QUALS vec32u vacc_get(vacc32u acc)
+{
+  return (vec32u)__builtin_apex_vec32_pack((vec16s)acc.lo, (vec16s)acc.hi);
+}
+
+/**
+ * Accumulate low (acc += c, sign-extend)
+ * @param acc The accumulator
+ * @param c The addend
+ */
+__APEX_INT_F_QUALS void vacc_acl(vacc32s* restrict acc, vec16s c)
+{
+  __builtin_apex_vacl(&acc->hi, (vec16s*)&acc->lo, c);
+}
+
+/**
+ * Accumulate low (acc += c, zero-extend)
+ * @param acc The accumulator
+ * @param c The addend
+ */
+__APEX_INT_F_QUALS void vacc_acl(vacc32u* restrict acc, vec16u c)
+{
+  __builtin_apex_vaclu((vec16s*)&acc->hi, (vec16s*)&acc->lo, (vec16s)c);
+}
+
+/**
+ * Accumulate middle, see vacm
+ * @param acc The accumulator
+ * @param c The addend
+ */
+__APEX_INT_F_QUALS void vacc_acm(vacc32s* restrict acc, vec16s c)
+{
+  __builtin_apex_vacm(&acc->hi, (vec16s*)&acc->lo, c);
+}
+
+/**
+ * Accumulate middle, see vacm
+ * @param acc The accumulator
+ * @param c The addend
+ */
+__APEX_INT_F_QUALS void vacc_acm(vacc32u* restrict acc, vec16u c)
+{
+  __builtin_apex_vacmu((vec16s*)&acc->hi, (vec16s*)&acc->lo, (vec16s)c);
+}
+
+/**
+ * Accumulate high (acc += c << 16)
+ * @param acc The accumulator
+ * @param c The addend
+ */
+__APEX_INT_F_QUALS void vacc_ach(vacc32s* restrict acc, vec16s c)
+{
+  acc->hi += c;
+}
+
+/**
+ * Accumulate high (acc += c << 16)
+ * @param acc The accumulator
+ * @param c The addend
+ */
+__APEX_INT_F_QUALS void vacc_ach(vacc32u* restrict acc, vec16u c)
+{
+  acc->hi += c;
+}
+
+/**
+ * Multiply-accumulate (acc += a * b, 16 x 16 -> 32-bit)
+ * @param acc The accumulator
+ * @param a The first factor
+ * @param b The second factor
+ */
+__APEX_INT_F_QUALS void vacc_mac(vacc32s* restrict acc, vec16s a, vec16s b)
+{
+  vec16s* h = &acc->hi;
+  vec16s* l = (vec16s*)&acc->lo;
+  __builtin_apex_vaclu(h, l, (vec16s)vmul_ulul(a, b));
+  *h += vmul_shsh(a, b);
+  __builtin_apex_vacm(h, l, vmul_shul(a, b));
+  __builtin_apex_vacm(h, l, vmul_ulsh(a, b));
+}
+
+/**
+ * Multiply-accumulate (acc += a * b, 16 x 16 -> 32-bit)
+ * @param acc The accumulator
+ * @param a The first factor
+ * @param b The second factor
+ */
+__APEX_INT_F_QUALS void vacc_mac(vacc32s* restrict acc, vec16u a, vec16s b)
+{
+  vec16s* h = &acc->hi;
+  vec16s* l = (vec16s*)&acc->lo;
+  __builtin_apex_vaclu(h, l, (vec16s)vmul_ulul(a, (vec16u)b));
+  *h += vmul_uhsh((vec16s)a, b);
+  __builtin_apex_vacmu(h, l, (vec16s)vmul_uhul(a, (vec16u)b));
+  __builtin_apex_vacm(h, l, vmul_ulsh((vec16s)a, b));
+}
+
+/**
+ * Multiply-accumulate (acc += a * b, 16 x 16 -> 32-bit)
+ * @param acc The accumulator
+ * @param a The first factor
+ * @param b The second factor
+ */
+__APEX_INT_F_QUALS void vacc_mac(vacc32u* restrict acc, vec16u a, vec16u b)
+{
+  vec16s* h = (vec16s*)&acc->hi;
+  vec16s* l = (vec16s*)&acc->lo;
+  __builtin_apex_vaclu(h, l, (vec16s)vmul_ulul(a, b));
+  *h += (vec16s)vmul_uhuh(a, b);
+  __builtin_apex_vacmu(h, l, (vec16s)vmul_uhul(a, b));
+  __builtin_apex_vacmu(h, l, (vec16s)vmul_uluh(a, b));
+}
+
+/**
+ * Narrow an accumulator to 16 bits: arithmetic shift right, then saturate
+ * @param acc The accumulator
+ * @param shift Right shift (0..31)
+ * @return sat16(acc >> shift)
+ */
+__APEX_INT_F_QUALS vec16s vacc_narrow(vacc32s acc, int shift)
+{
+  vec32s v   = vacc_get(acc) >> (vec32s)shift;
+  vec32s max = (vec32s)32767;
+  vec32s min = (vec32s)-32768;
+  v = vselect(max, v, vsgt(v, max));
+  v = vselect(min, v, vsgt(min, v));
+  return __builtin_convertvector(v, vec16s);
+}
+
+/**
+ * Narrow an accumulator to 16 bits: logical shift right, then saturate
+ * @param acc The accumulator
+ * @param shift Right shift (0..31)
+ * @return min(acc >> shift, 65535)
+ */
+__APEX_INT_F_QUALS vec16u vacc_narrow(vacc32u acc, int shift)
+{
+  vec32u v   = vacc_get(acc) >> (vec32u)shift;
+  vec32u max = (vec32u)65535;
+  v = vselect(max, v, vsgt(v, max));
+  return __builtin_convertvector(v, vec16u);
+}
+
+/**
+ * @}
+ */
+
+#endif
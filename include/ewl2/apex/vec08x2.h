@@ -0,0 +1,160 @@
+/*===---------------------------------------------------------------------===//
+ * (C) Copyright Freescale 2016, All rights reserved.
+ * FREESCALE CONFIDENTIAL PROPRIETARY
+ * Contains Confidential Proprietary information of Freescale, Inc.
+ * Reverse engineering is prohibited.
+ * The copyright notice does not imply publication.
+ *===---------------------------------------------------------------------===*/
+
+/**
+ * @file
+ * Packed 8-bit (SWAR) intrinsics.
+ *
+ * A vec08x2 holds two unsigned 8-bit pixels in each 16-bit CU lane, so one
+ * 16-bit ALU operation processes two pixels. Carries are kept from crossing
+ * the byte boundary by masking the top bit of each byte.
+ *
+ * Only the wrapping add / sub (5 operations per pair) and the bitwise
+ * operators beat two native 8-bit operations; the saturating, absdiff, min
+ * and max forms cost 16 to 33 operations per pair and only pay off where a
+ * kernel is limited by memory rather than by the ALU.
+ */
+
+#ifndef _APEX_VEC08X2_H
+#define _APEX_VEC08X2_H
+
+#include <apex/scalar-types.h>
+#include <apex/vector-types.h>
+
+#include <apex/intr-func-quals.h>
+
+/**
+ * @addtogroup vpackedInst Packed 8-bit Intrinsics
+ * @brief Two unsigned 8-bit elements per 16-bit lane
+ * @{
+ */
+
+typedef vec16u vec08x2;
+
+/**
+ * Packed load of two adjacent 8-bit elements
+ * @param ptr Base of an unsigned 8-bit line (2-byte aligned)
+ * @param i Index of the pair, i.e. elements 2i and 2i+1
+ * @return The pair in one lane
+ */
+__APEX_INT_F_QUALS vec08x2 vload_08x2(const vec08u* restrict ptr, int i)
+{
+  return ((const vec08x2*)ptr)[i];
+}
+
+/**
+ * Packed store of two adjacent 8-bit elements
+ * @param ptr Base of an unsigned 8-bit line (2-byte aligned)
+ * @param i Index of the pair, i.e. elements 2i and 2i+1
+ * @param v The pair
+ */
+__APEX_INT_F_QUALS void vstore_08x2(vec08u* restrict ptr, int i, vec08x2 v)
+{
+  ((vec08x2*)ptr)[i] = v;
+}
+
+/**
+ * Packed addition, modulo 256 per element
+ * @param va The first vector
+ * @param vb The second vector
+ * @return va + vb
+ */
+__APEX_INT_F_QUALS vec08x2 vadd_08x2(vec08x2 va, vec08x2 vb)
+{
+  vec08x2 lo7 = (vec08x2)0x7F7F;
+  vec08x2 hi1 = (vec08x2)0x8080;
+  return ((va & lo7) + (vb & lo7)) ^ ((va ^ vb) & hi1);
+}
+
+/**
+ * Per element mask 0xFF of the elements whose top bit is set in vm
+ * @param vm Vector with only bits 7 and 15 set
+ * @return 0x00FF / 0xFF00 / 0xFFFF / 0x0000 per lane
+ */
+__APEX_INT_F_QUALS vec08x2 vmask_08x2(vec08x2 vm)
+{
+  return (vm << (vec08x2)1) - (vm >> (vec08x2)7);
+}
+
+/**
+ * Packed addition, saturating at 255 per element
+ * @param va The first vector
+ * @param vb The second vector
+ * @return min(va + vb, 255)
+ */
+__APEX_INT_F_QUALS vec08x2 vadd_sat_08x2(vec08x2 va, vec08x2 vb)
+{
+  vec08x2 s = vadd_08x2(va, vb);
+  vec08x2 c = ((va & vb) | ((va | vb) & ~s)) & (vec08x2)0x8080;
+  return s | vmask_08x2(c);
+}
+
+/**
+ * Packed subtraction, modulo 256 per element
+ * @param va The first vector
+ * @param vb The second vector
+ * @return va - vb
+ */
+__APEX_INT_F_QUALS vec08x2 vsub_08x2(vec08x2 va, vec08x2 vb)
+{
+  vec08x2 lo7 = (vec08x2)0x7F7F;
+  vec08x2 hi1 = (vec08x2)0x8080;
+  return ((va | hi1) - (vb & lo7)) ^ ((va ^ ~vb) & hi1);
+}
+
+/**
+ * Packed subtraction, saturating at 0 per element
+ * @param va The first vector
+ * @param vb The second vector
+ * @return max(va - vb, 0)
+ */
+__APEX_INT_F_QUALS vec08x2 vsub_sat_08x2(vec08x2 va, vec08x2 vb)
+{
+  vec08x2 d = vsub_08x2(va, vb);
+  vec08x2 b = ((~va & vb) | (~(va ^ vb) & d)) & (vec08x2)0x8080;
+  return d & ~vmask_08x2(b);
+}
+
+/**
+ * Packed absolute difference
+ * @param va The first vector
+ * @param vb The second vector
+ * @return |va - vb|
+ */
+__APEX_INT_F_QUALS vec08x2 vabs_diff_08x2(vec08x2 va, vec08x2 vb)
+{
+  return vsub_sat_08x2(va, vb) | vsub_sat_08x2(vb, va);
+}
+
+/**
+ * Packed maximum
+ * @param va The first vector
+ * @param vb The second vector
+ * @return max(va, vb)
+ */
+__APEX_INT_F_QUALS vec08x2 vmax_08x2(vec08x2 va, vec08x2 vb)
+{
+  return vadd_08x2(va, vsub_sat_08x2(vb, va));
+}
+
+/**
+ * Packed minimum
+ * @param va The first vector
+ * @param vb The second vector
+ * @return min(va, vb)
+ */
+__APEX_INT_F_QUALS vec08x2 vmin_08x2(vec08x2 va, vec08x2 vb)
+{
+  return vsub_08x2(va, vsub_sat_08x2(va, vb));
+}
+
+/**
+ * @}
+ */
+
+#endif
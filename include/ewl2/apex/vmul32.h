@@ -0,0 +1,171 @@
+/*===---------------------------------------------------------------------===//
+ * (C) Copyright Freescale 2016, All rights reserved.
+ * FREESCALE CONFIDENTIAL PROPRIETARY
+ * Contains Confidential Proprietary information of Freescale, Inc.
+ * Reverse engineering is prohibited.
+ * The copyright notice does not imply publication.
+ *===---------------------------------------------------------------------===*/
+
+
+/**
+ * @file
+ * 32-bit vector multiply variants.
+ *
+ * A vec32 * vec32 product is lowered to the librt routine, which builds the
+ * full product from all 16x16 partial products. These inline variants build
+ * only what their result needs, on the split accumulators of vacc32.h:
+ * - vmul_lo32:  low 32 bits of a 32x32 product (3 partial products,
+ *               two of them only the low 16 bits)
+ * - vmul_16x32: low 32 bits of a 16x32 product (2 partial products)
+ * - vmul_hi32:  high 32 bits of a signed 32x32 product
+ * - vmul_q31:   Q31 fixed point product, (a * b) >> 31
+ */
+
+#ifndef _APEX_VMUL32_H
+#define _APEX_VMUL32_H
+
+#include <apex/scalar-types.h>
+#include <apex/vector-types.h>
+#include <apex/intr-func-quals.h>
+#include <apex/vacc32.h>
+
+/**
+ * @addtogroup vmul32Inst 32-bit Multiply Intrinsics
+ * @brief 32-bit vector multiplies from the minimal 16-bit partial products
+ * @{
+ */
+
+/**
+ * Multiplication of two vectors, low 32 bits of the product
+ * @param va The first vector
+ * @param vb The second vector
+ * @return va * vb modulo 2^32
+ */
+__APEX_INT_F_QUALS vec32u vmul_lo32(vec32u va, vec32u vb)
+{
+  vec16u al = (vec16u)__builtin_apex_vec32_get_lo((vec32s)va);
+  vec16u ah = (vec16u)__builtin_apex_vec32_get_hi((vec32s)va);
+  vec16u bl = (vec16u)__builtin_apex_vec32_get_lo((vec32s)vb);
+  vec16u bh = (vec16u)__builtin_apex_vec32_get_hi((vec32s)vb);
+
+  /* the cross products only reach the high half through their low 16 bits */
+  vacc32u acc;
+  acc.hi = ah * bl + al * bh;
+  acc.lo = 0;
+  vacc_mac(&acc, al, bl);
+  return vacc_get(acc);
+}
+
+/**
+ * Multiplication of two vectors, low 32 bits of the product
+ * @param va The first vector
+ * @param vb The second vector
+ * @return va * vb modulo 2^32
+ */
+__APEX_INT_F_QUALS vec32s vmul_lo32(vec32s va, vec32s vb)
+{
+  return (vec32s)vmul_lo32((vec32u)va, (vec32u)vb);
+}
+
+/**
+ * Widening multiplication of a 16-bit by a 32-bit vector
+ * @param va The 16-bit vector (sign-extended)
+ * @param vb The 32-bit vector
+ * @return va * vb modulo 2^32
+ */
+__APEX_INT_F_QUALS vec32s vmul_16x32(vec16s va, vec32s vb)
+{
+  vec16u bl = (vec16u)__builtin_apex_vec32_get_lo(vb);
+  vec16s bh = __builtin_apex_vec32_get_hi(vb);
+
+  vacc32s acc;
+  acc.hi = va * bh;
+  acc.lo = 0;
+  vacc_mac(&acc, bl, va);
+  return vacc_get(acc);
+}
+
+/**
+ * Widening multiplication of a 16-bit by a 32-bit vector
+ * @param va The 16-bit vector (zero-extended)
+ * @param vb The 32-bit vector
+ * @return va * vb modulo 2^32
+ */
+__APEX_INT_F_QUALS vec32u vmul_16x32(vec16u va, vec32u vb)
+{
+  vec16u bl = (vec16u)__builtin_apex_vec32_get_lo((vec32s)vb);
+  vec16u bh = (vec16u)__builtin_apex_vec32_get_hi((vec32s)vb);
+
+  vacc32u acc;
+  acc.hi = va * bh;
+  acc.lo = 0;
+  vacc_mac(&acc, va, bl);
+  return vacc_get(acc);
+}
+
+/**
+ * Core of vmul_hi32 / vmul_q31
+ * @param va The first vector
+ * @param vb The second vector
+ * @param carry [out] Low 16 bits of the column below the high half; bit 15
+ *              is bit 31 of the full product
+ * @return High 32 bits of va * vb
+ */
+__APEX_INT_F_QUALS vec32s __vmul_hi32(vec32s va, vec32s vb, vec16u* restrict carry)
+{
+  vec16u al = (vec16u)__builtin_apex_vec32_get_lo(va);
+  vec16s ah = __builtin_apex_vec32_get_hi(va);
+  vec16u bl = (vec16u)__builtin_apex_vec32_get_lo(vb);
+  vec16s bh = __builtin_apex_vec32_get_hi(vb);
+
+  vacc32u ll;  vacc_clear(&ll);  vacc_mac(&ll, al, bl);
+  vacc32s m1;  vacc_clear(&m1);  vacc_mac(&m1, al, bh);
+  vacc32s m2;  vacc_clear(&m2);  vacc_mac(&m2, bl, ah);
+  vacc32s hh;  vacc_clear(&hh);  vacc_mac(&hh, ah, bh);
+
+  /* bits 16..31 of the product: the low halves of the cross products plus
+     the high half of the low product; at most 3 * 0xFFFF */
+  vacc32u col;
+  vacc_clear(&col);
+  vacc_acl(&col, m1.lo);
+  vacc_acl(&col, m2.lo);
+  vacc_acl(&col, ll.hi);
+
+  vacc_acl(&hh, m1.hi);
+  vacc_acl(&hh, m2.hi);
+  vacc_acl(&hh, (vec16s)col.hi);
+  *carry = col.lo;
+  return vacc_get(hh);
+}
+
+/**
+ * Multiplication of two vectors, high 32 bits of the signed 64-bit product
+ * @param va The first vector
+ * @param vb The second vector
+ * @return (va * vb) >> 32
+ */
+__APEX_INT_F_QUALS vec32s vmul_hi32(vec32s va, vec32s vb)
+{
+  vec16u carry;
+  return __vmul_hi32(va, vb, &carry);
+}
+
+/**
+ * Q31 fixed point multiplication (truncating)
+ * @param va The first vector (Q31)
+ * @param vb The second vector (Q31)
+ * @return (va * vb) >> 31; -1.0 * -1.0 wraps to -1.0
+ */
+__APEX_INT_F_QUALS vec32s vmul_q31(vec32s va, vec32s vb)
+{
+  vec16u carry;
+  vec32s hi = __vmul_hi32(va, vb, &carry);
+  vec16u b31 = carry >> (vec16u)15;
+  return (hi << (vec32s)1) | (vec32s)__builtin_convertvector(b31, vec32u);
+}
+
+/**
+ * @}
+ */
+
+#endif
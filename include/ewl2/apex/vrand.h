@@ -0,0 +1,91 @@
+/*===---------------------------------------------------------------------===//
+ * (C) Copyright Freescale 2016, All rights reserved.
+ * FREESCALE CONFIDENTIAL PROPRIETARY
+ * Contains Confidential Proprietary information of Freescale, Inc.
+ * Reverse engineering is prohibited.
+ * The copyright notice does not imply publication.
+ *===---------------------------------------------------------------------===*/
+
+
+/**
+ * @file
+ * Per-CU pseudo random numbers.
+ *
+ * Every CU runs its own xorshift32 generator (period 2^32 - 1). The output is
+ * scrambled by a multiplication (xorshift32*), whose high bits pass the usual
+ * statistical tests far better than the raw state; take random bits from the
+ * top of the result. Generators are seeded per CU from one scalar seed through
+ * the murmur3 finaliser, so neighbouring CUs get unrelated sequences.
+ *
+ * Not suitable for cryptography.
+ */
+
+#ifndef _APEX_VRAND_H
+#define _APEX_VRAND_H
+
+#include <apex/scalar-types.h>
+#include <apex/vector-types.h>
+#include <apex/intr-func-quals.h>
+#include <apex/vmul32.h>
+#include <apex/vscan.h>
+
+/**
+ * @addtogroup vrandInst Random Number Intrinsics
+ * @brief Vector xorshift generators, one per CU
+ * @{
+ */
+
+/** State of one xorshift32 generator per CU; never all zero on a CU */
+typedef struct
+{
+  vec32u s;
+} vrand32;
+
+/**
+ * Seed the generators
+ * @param st The state
+ * @param seed Scalar seed; CU i uses a mix of seed and i
+ */
+__APEX_INT_F_QUALS void vrand_seed(vrand32* restrict st, int32u seed)
+{
+  vec32u idx = __builtin_convertvector(vscan_cu_index(), vec32u);
+  vec32u z   = (vec32u)seed + vmul_lo32(idx + (vec32u)1, (vec32u)0x9E3779B9u);
+
+  z = vmul_lo32(z ^ (z >> (vec32u)16), (vec32u)0x85EBCA6Bu);
+  z = vmul_lo32(z ^ (z >> (vec32u)13), (vec32u)0xC2B2AE35u);
+  z = z ^ (z >> (vec32u)16);
+
+  /* zero is the one state xorshift never leaves */
+  st->s = vselect((vec32u)0x6D2B79F5u, z, vseq(z, (vec32u)0));
+}
+
+/**
+ * Advance the generators
+ * @param st The state
+ * @return 32 random bits per CU
+ */
+__APEX_INT_F_QUALS vec32u vrand_next(vrand32* restrict st)
+{
+  vec32u x = st->s;
+  x = x ^ (x << (vec32u)13);
+  x = x ^ (x >> (vec32u)17);
+  x = x ^ (x << (vec32u)5);
+  st->s = x;
+  return vmul_lo32(x, (vec32u)0x2C1B3C6Du);
+}
+
+/**
+ * Advance the generators
+ * @param st The state
+ * @return 16 random bits per CU (the top half of vrand_next)
+ */
+__APEX_INT_F_QUALS vec16u vrand_next16(vrand32* restrict st)
+{
+  return (vec16u)__builtin_apex_vec32_get_hi((vec32s)vrand_next(st));
+}
+
+/**
+ * @}
+ */
+
+#endif
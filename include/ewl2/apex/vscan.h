@@ -0,0 +1,173 @@
+/*===---------------------------------------------------------------------===//
+ * (C) Copyright Freescale 2016, All rights reserved.
+ * FREESCALE CONFIDENTIAL PROPRIETARY
+ * Contains Confidential Proprietary information of Freescale, Inc.
+ * Reverse engineering is prohibited.
+ * The copyright notice does not imply publication.
+ *===---------------------------------------------------------------------===*/
+
+
+/**
+ * @file
+ * Prefix sums (scans) across the CU array.
+ *
+ * Log-step (Hillis-Steele) scans: step k adds the vector moved right by k CUs,
+ * for k = 1, 2, 4, ... APU_VSIZE / 2. The moves are chains of vmr with a zero
+ * fill, so a full scan costs APU_VSIZE - 1 moves and log2(APU_VSIZE) adds.
+ *
+ * The 32-bit scans keep the two 16-bit halves apart for the whole scan: the
+ * halves are moved separately and added with vadd / vaddx, the carry out of
+ * the low half feeding the high one, instead of unpacking and repacking the
+ * vec32 at every step.
+ *
+ * Sums wrap around modulo 2^16 (2^32) like the underlying adds.
+ */
+
+#ifndef _APEX_VSCAN_H
+#define _APEX_VSCAN_H
+
+#include <apex/scalar-types.h>
+#include <apex/vector-types.h>
+#include <apex/intr-func-quals.h>
+
+/**
+ * @addtogroup vscanInst Scan Intrinsics
+ * @brief Inclusive and exclusive prefix sums across the CUs
+ * @{
+ */
+
+/**
+ * Move a vector right by k CUs, zero filled
+ */
+__APEX_INT_F_QUALS vec16s __vscan_move(vec16s v, int k)
+{
+  vec16s zero = 0;
+  for (int i = 0; i < k; ++i)
+  {
+    v = vmr(v, zero);
+  }
+  return v;
+}
+
+/**
+ * Inclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i]
+ */
+__APEX_INT_F_QUALS vec16s vscan_incl(vec16s v)
+{
+  for (int k = 1; k < APU_VSIZE; k <<= 1)
+  {
+    v = v + __vscan_move(v, k);
+  }
+  return v;
+}
+
+/**
+ * Inclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i]
+ */
+__APEX_INT_F_QUALS vec16u vscan_incl(vec16u v)
+{
+  return (vec16u)vscan_incl((vec16s)v);
+}
+
+/**
+ * Exclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i-1], CU 0 receives 0
+ */
+__APEX_INT_F_QUALS vec16s vscan_excl(vec16s v)
+{
+  return vscan_incl(__vscan_move(v, 1));
+}
+
+/**
+ * Exclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i-1], CU 0 receives 0
+ */
+__APEX_INT_F_QUALS vec16u vscan_excl(vec16u v)
+{
+  return (vec16u)vscan_excl((vec16s)v);
+}
+
+/**
+ * Inclusive scan of a vector given as its 16-bit halves
+ * @param hi High half, replaced by the high half of the scan
+ * @param lo Low half, replaced by the low half of the scan
+ */
+__APEX_INT_F_QUALS void __vscan_incl32(vec16s* restrict hi, vec16s* restrict lo)
+{
+  /* the carry forms of vadd / vaddx are macros in C and reference overloads
+     in C++; the builtins are the same in every mode */
+  for (int k = 1; k < APU_VSIZE; k <<= 1)
+  {
+    vbool c, cout;
+    vec16s mlo = __vscan_move(*lo, k);
+    vec16s mhi = __vscan_move(*hi, k);
+    *lo = __builtin_apex_vaddc(*lo, mlo, &c);
+    *hi = __builtin_apex_vadde(*hi, mhi, c, &cout);
+  }
+}
+
+/**
+ * Inclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i]
+ */
+__APEX_INT_F_QUALS vec32s vscan_incl(vec32s v)
+{
+  vec16s lo = __builtin_apex_vec32_get_lo(v);
+  vec16s hi = __builtin_apex_vec32_get_hi(v);
+  __vscan_incl32(&hi, &lo);
+  return __builtin_apex_vec32_pack(lo, hi);
+}
+
+/**
+ * Inclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i]
+ */
+__APEX_INT_F_QUALS vec32u vscan_incl(vec32u v)
+{
+  return (vec32u)vscan_incl((vec32s)v);
+}
+
+/**
+ * Exclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i-1], CU 0 receives 0
+ */
+__APEX_INT_F_QUALS vec32s vscan_excl(vec32s v)
+{
+  vec16s lo = __vscan_move(__builtin_apex_vec32_get_lo(v), 1);
+  vec16s hi = __vscan_move(__builtin_apex_vec32_get_hi(v), 1);
+  __vscan_incl32(&hi, &lo);
+  return __builtin_apex_vec32_pack(lo, hi);
+}
+
+/**
+ * Exclusive scan across the CUs
+ * @param v The vector
+ * @return CU i receives v[0] + ... + v[i-1], CU 0 receives 0
+ */
+__APEX_INT_F_QUALS vec32u vscan_excl(vec32u v)
+{
+  return (vec32u)vscan_excl((vec32s)v);
+}
+
+/**
+ * Index of each CU, 0 for the leftmost one
+ */
+__APEX_INT_F_QUALS vec16s vscan_cu_index(void)
+{
+  return vscan_excl((vec16s)1);
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,189 @@
+/*===---------------------------------------------------------------------===//
+ * (C) Copyright Freescale 2016, All rights reserved.
+ * FREESCALE CONFIDENTIAL PROPRIETARY
+ * Contains Confidential Proprietary information of Freescale, Inc.
+ * Reverse engineering is prohibited.
+ * The copyright notice does not imply publication.
+ *===---------------------------------------------------------------------===*/
+
+
+/**
+ * @file
+ * Vector sorting networks.
+ *
+ * Two directions are covered:
+ * - within a CU: vsort_cmpx orders two vectors lane by lane (one vswap), the
+ *   building block of sorting networks over rows or neighbourhoods;
+ * - across the CU array: vsort_lanes sorts the APU_VSIZE lanes of one vector
+ *   with a bitonic network. The partner of a lane at distance j is fetched
+ *   with j vml and j vmr steps. A full sort has
+ *   log2(APU_VSIZE) * (log2(APU_VSIZE) + 1) / 2 compare-exchange stages and
+ *   4 * APU_VSIZE - 4 - 2 * log2(APU_VSIZE) moves, 114 for 32 lanes; a bitonic
+ *   merge alone takes 2 * (APU_VSIZE - 1) moves, 62 for 32 lanes.
+ *
+ * Unsigned vectors are sorted through their signed image (v ^ 0x8000), which
+ * preserves the order.
+ */
+
+#ifndef _APEX_VSORT_H
+#define _APEX_VSORT_H
+
+#include <apex/scalar-types.h>
+#include <apex/vector-types.h>
+#include <apex/intr-func-quals.h>
+#include <apex/vscan.h>
+
+/**
+ * @addtogroup vsortInst Sorting Intrinsics
+ * @brief Compare-exchange and bitonic sorting networks
+ * @{
+ */
+
+/**
+ * Lane by lane compare-exchange
+ * @param a First vector, receives the smaller element of each lane
+ * @param b Second vector, receives the larger element of each lane
+ */
+__APEX_INT_F_QUALS void vsort_cmpx(vec16s* restrict a, vec16s* restrict b)
+{
+  /* vswap is a macro taking lvalues in C; the builtin takes the pointers in
+     every mode */
+  __builtin_apex_vswap(a, b, vsgt(*a, *b));
+}
+
+/**
+ * Lane by lane compare-exchange
+ * @param a First vector, receives the smaller element of each lane
+ * @param b Second vector, receives the larger element of each lane
+ */
+__APEX_INT_F_QUALS void vsort_cmpx(vec16u* restrict a, vec16u* restrict b)
+{
+  __builtin_apex_vswap((vec16s*)a, (vec16s*)b, vsgt(*a, *b));
+}
+
+/**
+ * One stage of a bitonic network across the lanes
+ * @param v The vector
+ * @param idx Lane index, see vscan_cu_index
+ * @param j Distance of the compared lanes
+ * @param k Size of the blocks sorted by the current merge
+ * @param desc Nonzero to sort in descending order
+ * @return v after the compare-exchange of lanes i and i ^ j
+ */
+__APEX_INT_F_QUALS vec16s __vsort_stage(vec16s v, vec16s idx, int j, int k, int desc)
+{
+  vec16s r = v;
+  vec16s l = v;
+  for (int i = 0; i < j; ++i)
+  {
+    r = vml(r, r);
+    l = vmr(l, l);
+  }
+
+  vec16s zero  = 0;
+  vec16s one   = 1;
+  vbool  upper = vsne(idx & (vec16s)j, zero);
+  vec16s p     = vselect(l, r, upper);
+
+  /* a lane keeps the smaller value when it is the lower lane of an ascending
+     block or the upper lane of a descending one */
+  vec16s up    = vselect(one, zero, upper);
+  vec16s dn    = vselect(one, zero, vsne(idx & (vec16s)k, zero)) ^ (vec16s)(desc ? 1 : 0);
+  vbool  gt    = vsgt(v, p);
+  vec16s lo    = vselect(p, v, gt);
+  vec16s hi    = vselect(v, p, gt);
+
+  return vselect(lo, hi, vseq(up, dn));
+}
+
+/**
+ * Sort a bitonic sequence across the lanes
+ * @param v A bitonic vector (ascending then descending, or a rotation of it)
+ * @param desc Nonzero to sort in descending order
+ * @return The lanes of v in ascending (descending) order
+ */
+__APEX_INT_F_QUALS vec16s vsort_bitonic_merge(vec16s v, int desc)
+{
+  vec16s idx = vscan_cu_index();
+
+  for (int j = APU_VSIZE >> 1; j > 0; j >>= 1)
+  {
+    v = __vsort_stage(v, idx, j, APU_VSIZE, desc);
+  }
+  return v;
+}
+
+/**
+ * Sort a bitonic sequence across the lanes
+ * @param v A bitonic vector
+ * @param desc Nonzero to sort in descending order
+ * @return The lanes of v in ascending (descending) order
+ */
+__APEX_INT_F_QUALS vec16u vsort_bitonic_merge(vec16u v, int desc)
+{
+  vec16u bias = 0x8000;
+  return (vec16u)vsort_bitonic_merge((vec16s)(v ^ bias), desc) ^ bias;
+}
+
+/**
+ * Sort the lanes of a vector (bitonic sort across the CU array)
+ * @param v The vector
+ * @param desc Nonzero to sort in descending order
+ * @return The lanes of v in ascending (descending) order, lane 0 first
+ */
+__APEX_INT_F_QUALS vec16s vsort_lanes(vec16s v, int desc)
+{
+  vec16s idx = vscan_cu_index();
+
+  for (int k = 2; k <= APU_VSIZE; k <<= 1)
+  {
+    for (int j = k >> 1; j > 0; j >>= 1)
+    {
+      v = __vsort_stage(v, idx, j, k, desc);
+    }
+  }
+  return v;
+}
+
+/**
+ * Sort the lanes of a vector (bitonic sort across the CU array)
+ * @param v The vector
+ * @param desc Nonzero to sort in descending order
+ * @return The lanes of v in ascending (descending) order, lane 0 first
+ */
+__APEX_INT_F_QUALS vec16u vsort_lanes(vec16u v, int desc)
+{
+  vec16u bias = 0x8000;
+  return (vec16u)vsort_lanes((vec16s)(v ^ bias), desc) ^ bias;
+}
+
+/**
+ * Merge two sorted runs of APU_VSIZE elements
+ * @param a An ascending run, receives the smaller half in ascending order
+ * @param b A descending run, receives the larger half in ascending order
+ */
+__APEX_INT_F_QUALS void vsort_merge(vec16s* restrict a, vec16s* restrict b)
+{
+  /* min and max of an ascending and a descending run are both bitonic */
+  vsort_cmpx(a, b);
+  *a = vsort_bitonic_merge(*a, 0);
+  *b = vsort_bitonic_merge(*b, 0);
+}
+
+/**
+ * Merge two sorted runs of APU_VSIZE elements
+ * @param a An ascending run, receives the smaller half in ascending order
+ * @param b A descending run, receives the larger half in ascending order
+ */
+__APEX_INT_F_QUALS void vsort_merge(vec16u* restrict a, vec16u* restrict b)
+{
+  vsort_cmpx(a, b);
+  *a = vsort_bitonic_merge(*a, 0);
+  *b = vsort_bitonic_merge(*b, 0);
+}
+
+/**
+ * @}
+ */
+
+#endif